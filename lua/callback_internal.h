@@ -201,10 +201,15 @@ template<typename ReturnType, typename...ArgTypes>
 struct PCallHelper {
   static ReturnType Run(State* state, std::shared_ptr<Handle> handle,
                         ArgTypes&&... args) {
-    ReturnType result = ReturnType();
-    int top = GetTop(state);
     DCHECK_EQ(state, handle->state());
     handle->Push();
+    return RunOnTop(state, std::forward<ArgTypes>(args)...);
+  }
+
+  // Call the function on top of stack, which is popped after calling.
+  static ReturnType RunOnTop(State* state, ArgTypes&&... args) {
+    ReturnType result = ReturnType();
+    int top = GetTop(state) - 1;
     if (!PCall(state, &result, std::forward<ArgTypes>(args)...)) {
       std::string error;
       lua::Pop(state, &error);
@@ -220,9 +225,13 @@ template<typename...ArgTypes>
 struct PCallHelper<void, ArgTypes...> {
   static void Run(State* state, std::shared_ptr<Handle> handle,
                   ArgTypes&&... args) {
-    int top = GetTop(state);
     DCHECK_EQ(state, handle->state());
     handle->Push();
+    RunOnTop(state, std::forward<ArgTypes>(args)...);
+  }
+
+  static void RunOnTop(State* state, ArgTypes&&... args) {
+    int top = GetTop(state) - 1;
     if (!PCall(state, nullptr, std::forward<ArgTypes>(args)...)) {
       std::string error;
       lua::Pop(state, &error);
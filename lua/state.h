@@ -5,6 +5,8 @@
 #ifndef LUA_STATE_H_
 #define LUA_STATE_H_
 
+#include <string>
+
 extern "C" {
 #include "third_party/lua-compat-5.3/c-api/compat-5.3.h"
 }
@@ -33,6 +35,22 @@ class ManagedState {
   State* state_;
 };
 
+namespace internal {
+
+// Collect the output of lua_dump.
+inline int WriteChunk(State* state, const void* p, size_t size, void* chunk) {
+  static_cast<std::string*>(chunk)->append(static_cast<const char*>(p), size);
+  return 0;
+}
+
+}  // namespace internal
+
+// Append the bytecode of the function on top of stack to |chunk|, the debug
+// information is removed when |strip| is true.
+inline void Dump(State* state, std::string* chunk, bool strip = false) {
+  lua_dump(state, &internal::WriteChunk, chunk, strip ? 1 : 0);
+}
+
 }  // namespace lua
 
 #endif  // LUA_STATE_H_
@@ -0,0 +1,120 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "lua_yue/app_bundle.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_enumerator.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/json/json_writer.h"
+#include "base/pickle.h"
+#include "base/strings/string_number_conversions.h"
+#include "lua/lua.h"
+
+namespace yue {
+
+namespace {
+
+// Compile the lua source file to bytecode.
+bool CompileFile(const base::FilePath& path,
+                 std::string* bytecode,
+                 std::string* error) {
+  lua::ManagedState state;
+  if (luaL_loadfile(state, path.AsUTF8Unsafe().c_str()) != LUA_OK) {
+    lua::Pop(state, error);
+    return false;
+  }
+  lua::Dump(state, bytecode, true /* strip */);
+  return true;
+}
+
+// Add files under |dir| to the |files| node of asar header, and append their
+// content to |content|.
+bool AddDirectory(const base::FilePath& dir,
+                  base::Value::Dict* files,
+                  std::string* content,
+                  std::string* error) {
+  std::vector<base::FilePath> paths;
+  base::FileEnumerator enumerator(
+      dir, false,
+      base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES);
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next())
+    paths.push_back(std::move(path));
+  // Sort the files so the archive is reproducible.
+  std::sort(paths.begin(), paths.end());
+
+  for (const base::FilePath& path : paths) {
+    std::string name = path.BaseName().AsUTF8Unsafe();
+    base::Value::Dict node;
+    if (base::DirectoryExists(path)) {
+      base::Value::Dict children;
+      if (!AddDirectory(path, &children, content, error))
+        return false;
+      node.Set("files", std::move(children));
+    } else {
+      std::string data;
+      if (path.MatchesExtension(FILE_PATH_LITERAL(".lua"))) {
+        if (!CompileFile(path, &data, error))
+          return false;
+      } else if (!base::ReadFileToString(path, &data)) {
+        *error = "Unable to read " + path.AsUTF8Unsafe();
+        return false;
+      }
+      node.Set("size", static_cast<int>(data.size()));
+      node.Set("offset", base::NumberToString(content->size()));
+      content->append(data);
+    }
+    files->Set(name, std::move(node));
+  }
+  return true;
+}
+
+}  // namespace
+
+bool CreateAppBundle(const base::FilePath& source_dir,
+                     const base::FilePath& output,
+                     std::string* error) {
+  if (!base::DirectoryExists(source_dir)) {
+    *error = source_dir.AsUTF8Unsafe() + " is not a directory";
+    return false;
+  }
+
+  base::Value::Dict files;
+  std::string content;
+  if (!AddDirectory(source_dir, &files, &content, error))
+    return false;
+  base::Value::Dict root;
+  root.Set("files", std::move(files));
+  std::string json;
+  if (!base::JSONWriter::Write(root, &json)) {
+    *error = "Unable to serialize archive header";
+    return false;
+  }
+
+  // | size pickle(8) | header pickle | content |
+  base::Pickle header_pickle;
+  header_pickle.WriteString(json);
+  base::Pickle size_pickle;
+  size_pickle.WriteUInt32(static_cast<uint32_t>(header_pickle.size()));
+
+  std::string archive;
+  archive.reserve(size_pickle.size() + header_pickle.size() + content.size());
+  archive.append(static_cast<const char*>(size_pickle.data()),
+                 size_pickle.size());
+  archive.append(static_cast<const char*>(header_pickle.data()),
+                 header_pickle.size());
+  archive.append(content);
+  if (!base::WriteFile(output, archive)) {
+    *error = "Unable to write " + output.AsUTF8Unsafe();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace yue
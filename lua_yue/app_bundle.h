@@ -0,0 +1,27 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef LUA_YUE_APP_BUNDLE_H_
+#define LUA_YUE_APP_BUNDLE_H_
+
+#include <string>
+
+namespace base {
+class FilePath;
+}
+
+namespace yue {
+
+// Pack all files under |source_dir| into an asar archive at |output|, which
+// can be loaded with InsertArchiveModuleLoader.
+//
+// The .lua files are precompiled to stripped bytecode so they do not need to
+// be parsed at startup, other files are stored unchanged.
+bool CreateAppBundle(const base::FilePath& source_dir,
+                     const base::FilePath& output,
+                     std::string* error);
+
+}  // namespace yue
+
+#endif  // LUA_YUE_APP_BUNDLE_H_
@@ -0,0 +1,73 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "lua_yue/app_bundle.h"
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "lua_yue/builtin_loader.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class AppBundleTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    luaL_openlibs(state_);
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    app_dir_ = temp_dir_.GetPath().AppendASCII("app");
+    archive_ = temp_dir_.GetPath().AppendASCII("app.asar");
+    ASSERT_TRUE(base::CreateDirectory(app_dir_.AppendASCII("lib")));
+    ASSERT_TRUE(base::WriteFile(app_dir_.AppendASCII("main.lua"),
+                                "return require('lib.util').value + 1"));
+    ASSERT_TRUE(base::WriteFile(app_dir_.AppendASCII("lib/util.lua"),
+                                "return { value = 41 }"));
+    ASSERT_TRUE(base::WriteFile(app_dir_.AppendASCII("lib/init.lua"),
+                                "return 'lib'"));
+  }
+
+  lua::ManagedState state_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath app_dir_;
+  base::FilePath archive_;
+};
+
+TEST_F(AppBundleTest, RequireFromArchive) {
+  std::string error;
+  ASSERT_TRUE(yue::CreateAppBundle(app_dir_, archive_, &error)) << error;
+  ASSERT_TRUE(yue::InsertArchiveModuleLoader(state_, archive_));
+  lua_getglobal(state_, "require");
+  int result = 0;
+  ASSERT_TRUE(lua::PCall(state_, &result, "main"));
+  EXPECT_EQ(result, 42);
+  lua_getglobal(state_, "require");
+  std::string lib;
+  ASSERT_TRUE(lua::PCall(state_, &lib, "lib"));
+  EXPECT_EQ(lib, "lib");
+}
+
+TEST_F(AppBundleTest, ModulesArePrecompiled) {
+  std::string error;
+  ASSERT_TRUE(yue::CreateAppBundle(app_dir_, archive_, &error)) << error;
+  std::string content;
+  ASSERT_TRUE(base::ReadFileToString(archive_, &content));
+  EXPECT_EQ(content.find("require('lib.util')"), std::string::npos);
+  EXPECT_NE(content.find(LUA_SIGNATURE), std::string::npos);
+}
+
+TEST_F(AppBundleTest, CompileError) {
+  ASSERT_TRUE(base::WriteFile(app_dir_.AppendASCII("bad.lua"), "return +"));
+  std::string error;
+  EXPECT_FALSE(yue::CreateAppBundle(app_dir_, archive_, &error));
+  EXPECT_NE(error.find("bad.lua"), std::string::npos);
+}
+
+TEST_F(AppBundleTest, ModuleNotFound) {
+  std::string error;
+  ASSERT_TRUE(yue::CreateAppBundle(app_dir_, archive_, &error)) << error;
+  ASSERT_TRUE(yue::InsertArchiveModuleLoader(state_, archive_));
+  ASSERT_FALSE(luaL_dostring(state_, "assert(not pcall(require, 'nope'))"));
+}
+
+TEST_F(AppBundleTest, InvalidArchive) {
+  EXPECT_FALSE(yue::InsertArchiveModuleLoader(state_, archive_));
+}
@@ -104,6 +104,33 @@ struct Type<nu::Size> {
   }
 };
 
+template<>
+struct Type<nu::Rect> {
+  static constexpr const char* name = "Rect";
+  static inline void Push(State* state, const nu::Rect& rect) {
+    lua::NewTable(state);
+    lua::RawSet(state, -1,
+                "x", rect.x(), "y", rect.y(),
+                "width", rect.width(), "height", rect.height());
+  }
+  static inline bool To(State* state, int index, nu::Rect* out) {
+    int x = 0, y = 0, width = 0, height = 0;
+    if (GetTop(state) - index == 3 &&
+        lua::To(state, index, &x, &y, &width, &height)) {
+      *out = nu::Rect(x, y, width, height);
+      return true;
+    }
+    if (GetType(state, index) != LuaType::Table)
+      return false;
+    if (!ReadOptions(state, index,
+                     "x", &x, "y", &y,
+                     "width", &width, "height", &height))
+      return false;
+    *out = nu::Rect(x, y, width, height);
+    return true;
+  }
+};
+
 template<>
 struct Type<nu::SizeF> {
   static constexpr const char* name = "SizeF";
@@ -463,6 +490,84 @@ struct Type<nu::TextAttributes> {
   }
 };
 
+template<>
+struct Type<nu::Animation::Easing> {
+  static constexpr const char* name = "AnimationEasing";
+  static inline bool To(State* state, int index, nu::Animation::Easing* out) {
+    std::string easing;
+    if (!lua::To(state, index, &easing))
+      return false;
+    if (easing == "linear") {
+      *out = nu::Animation::Easing::Linear;
+      return true;
+    } else if (easing == "ease") {
+      *out = nu::Animation::Easing::Ease;
+      return true;
+    } else if (easing == "ease-in") {
+      *out = nu::Animation::Easing::EaseIn;
+      return true;
+    } else if (easing == "ease-out") {
+      *out = nu::Animation::Easing::EaseOut;
+      return true;
+    } else if (easing == "ease-in-out") {
+      *out = nu::Animation::Easing::EaseInOut;
+      return true;
+    } else {
+      return false;
+    }
+  }
+  static inline void Push(State* state, nu::Animation::Easing easing) {
+    switch (easing) {
+      case nu::Animation::Easing::Linear:
+        return lua::Push(state, "linear");
+      case nu::Animation::Easing::Ease:
+        return lua::Push(state, "ease");
+      case nu::Animation::Easing::EaseIn:
+        return lua::Push(state, "ease-in");
+      case nu::Animation::Easing::EaseOut:
+        return lua::Push(state, "ease-out");
+      case nu::Animation::Easing::EaseInOut:
+        return lua::Push(state, "ease-in-out");
+    }
+    NOTREACHED();
+    return lua::Push(state, nullptr);
+  }
+};
+
+template<>
+struct Type<nu::Animation> {
+  static constexpr const char* name = "Animation";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "create", &CreateOnHeap<nu::Animation, int>,
+           "setduration", &nu::Animation::SetDuration,
+           "getduration", &nu::Animation::GetDuration,
+           "setdelay", &nu::Animation::SetDelay,
+           "getdelay", &nu::Animation::GetDelay,
+           "seteasing", &nu::Animation::SetEasing,
+           "geteasing", &nu::Animation::GetEasing,
+           "animatebounds", &nu::Animation::AnimateBounds,
+           "animatecolor", &nu::Animation::AnimateColor,
+           "animatebackgroundcolor", &nu::Animation::AnimateBackgroundColor,
+           "animatestyle", &AnimateStyle,
+#if defined(OS_LINUX) || defined(OS_MAC)
+           "animateopacity", &nu::Animation::AnimateOpacity,
+#endif
+           "clear", &nu::Animation::Clear,
+           "start", &nu::Animation::Start,
+           "stop", &nu::Animation::Stop,
+           "isrunning", &nu::Animation::IsRunning);
+    RawSetProperty(state, metatable, "onfinish", &nu::Animation::on_finish);
+  }
+  static void AnimateStyle(nu::Animation* animation,
+                           nu::View* view,
+                           const std::string& name,
+                           float from,
+                           float to) {
+    animation->AnimateStyle(view, name, from, to);
+  }
+};
+
 #if defined(OS_MAC)
 template<>
 struct Type<nu::App::ActivationPolicy> {
@@ -818,7 +923,11 @@ struct Type<nu::Canvas> {
            "createformainscreen", &CreateOnHeap<nu::Canvas, const nu::SizeF&>,
            "getscalefactor", &nu::Canvas::GetScaleFactor,
            "getpainter", &nu::Canvas::GetPainter,
-           "getsize", &nu::Canvas::GetSize);
+           "getsize", &nu::Canvas::GetSize,
+           "resize", &nu::Canvas::Resize,
+           "getpixelsize", &nu::Canvas::GetPixelSize,
+           "getimagedata", &nu::Canvas::GetImageData,
+           "putimagedata", &nu::Canvas::PutImageData);
   }
 };
 
@@ -1060,7 +1169,9 @@ struct Type<nu::Container> {
            "removechildview",
            RefMethod(state, &nu::Container::RemoveChildView, RefType::Deref),
            "childcount", &nu::Container::ChildCount,
-           "childat", &ChildAt);
+           "childat", &ChildAt,
+           "setusedisplaylist", &nu::Container::SetUseDisplayList,
+           "isusingdisplaylist", &nu::Container::IsUsingDisplayList);
     RawSetProperty(state, index, "ondraw", &nu::Container::on_draw);
   }
   // Transalte 1-based index to 0-based.
@@ -1479,10 +1590,8 @@ struct Type<nu::Font> {
   static constexpr const char* name = "Font";
   static void BuildMetaTable(State* state, int index) {
     RawSet(state, index,
-           "create", &CreateOnHeap<nu::Font, const std::string&, float,
-                                   nu::Font::Weight, nu::Font::Style>,
-           "createfrompath", &CreateOnHeap<nu::Font, const base::FilePath&,
-                                           float>,
+           "create", &nu::Font::Get,
+           "createfrompath", &nu::Font::GetFromPath,
            "default", &nu::Font::Default,
            "derive", &nu::Font::Derive,
            "getname", &nu::Font::GetName,
@@ -1535,6 +1644,40 @@ struct Type<nu::Group> {
   }
 };
 
+template<>
+struct Type<nu::Image::Format> {
+  static constexpr const char* name = "ImageFormat";
+  static inline bool To(State* state, int index, nu::Image::Format* out) {
+    std::string format;
+    if (!lua::To(state, index, &format))
+      return false;
+    if (format == "png")
+      *out = nu::Image::Format::PNG;
+    else if (format == "jpeg")
+      *out = nu::Image::Format::JPEG;
+    else if (format == "qoi")
+      *out = nu::Image::Format::QOI;
+    else
+      return false;
+    return true;
+  }
+};
+
+template<>
+struct Type<nu::Image::EncodeOptions> {
+  static constexpr const char* name = "ImageEncodeOptions";
+  static inline bool To(State* state, int index,
+                        nu::Image::EncodeOptions* out) {
+    if (GetType(state, index) != LuaType::Table)
+      return false;
+    return ReadOptions(state, index,
+                       "format", &out->format,
+                       "compression", &out->compression,
+                       "quality", &out->quality,
+                       "progressive", &out->progressive);
+  }
+};
+
 template<>
 struct Type<nu::Image> {
   static constexpr const char* name = "Image";
@@ -1555,7 +1698,9 @@ struct Type<nu::Image> {
            "tint", &nu::Image::Tint,
            "resize", &nu::Image::Resize,
            "topng", &nu::Image::ToPNG,
-           "tojpeg", &nu::Image::ToJPEG);
+           "tojpeg", &nu::Image::ToJPEG,
+           "encode", &nu::Image::Encode,
+           "encodetofile", &nu::Image::EncodeToFile);
   }
 };
 
@@ -2056,13 +2201,72 @@ struct Type<nu::Painter> {
            "clear", &nu::Painter::Clear,
            "strokerect", &nu::Painter::StrokeRect,
            "fillrect", &nu::Painter::FillRect,
+           "fillpath", &nu::Painter::FillPath,
+           "strokepath", &nu::Painter::StrokePath,
+           "fillrects", &FillRects,
+           "strokepolyline", &nu::Painter::StrokePolyline,
+           "drawpoints", &DrawPoints,
            "drawimage", &nu::Painter::DrawImage,
            "drawimagefromrect", &nu::Painter::DrawImageFromRect,
            "drawcanvas", &nu::Painter::DrawCanvas,
            "drawcanvasfromrect", &nu::Painter::DrawCanvasFromRect,
            "drawattributedtext", &nu::Painter::DrawAttributedText,
+           "getdirtyrects", &nu::Painter::GetDirtyRects,
+           "isrectdirty", &nu::Painter::IsRectDirty,
+#if defined(OS_LINUX)
+           "setuseglyphatlas", &nu::Painter::SetUseGlyphAtlas,
+#endif
            "drawtext", &nu::Painter::DrawText);
   }
+  // The colors are optional.
+  static bool ReadColors(CallContext* context, int index, nu::Buffer* colors) {
+    State* state = context->state;
+    if (GetTop(state) < index || GetType(state, index) == LuaType::Nil)
+      return true;
+    if (To(state, index, colors))
+      return true;
+    PushFormatedString(state, "The arg %d should be string", index);
+    context->has_error = true;
+    return false;
+  }
+  static void FillRects(CallContext* context,
+                        nu::Painter* painter,
+                        const nu::Buffer& rects) {
+    nu::Buffer colors;
+    if (ReadColors(context, 3, &colors))
+      painter->FillRects(rects, colors);
+  }
+  static void DrawPoints(CallContext* context,
+                         nu::Painter* painter,
+                         const nu::Buffer& points,
+                         float diameter) {
+    nu::Buffer colors;
+    if (ReadColors(context, 4, &colors))
+      painter->DrawPoints(points, diameter, colors);
+  }
+};
+
+template<>
+struct Type<nu::Path> {
+  static constexpr const char* name = "Path";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "create", &CreateOnHeap<nu::Path>,
+           "createfromsvg", &CreateOnHeap<nu::Path, const std::string&>,
+           "createfromdata",
+           &CreateOnHeap<nu::Path, const std::vector<float>&>,
+           "moveto", &nu::Path::MoveTo,
+           "lineto", &nu::Path::LineTo,
+           "beziercurveto", &nu::Path::BezierCurveTo,
+           "quadraticcurveto", &nu::Path::QuadraticCurveTo,
+           "arc", &nu::Path::Arc,
+           "rect", &nu::Path::Rect,
+           "closepath", &nu::Path::ClosePath,
+           "clear", &nu::Path::Clear,
+           "isempty", &nu::Path::IsEmpty,
+           "getbounds", &nu::Path::GetBounds,
+           "getdata", &nu::Path::GetData);
+  }
 };
 
 template<>
@@ -2357,6 +2561,7 @@ struct Type<nu::TableModel> {
            "setvalue", &SetValue,
            "getvalue", &GetValue,
            "notifyrowinsertion", &NotifyRowInsertion,
+           "notifyrowsinsertion", &NotifyRowsInsertion,
            "notifyrowdeletion", &NotifyRowDeletion,
            "notifyvaluechange", &NotifyValueChange);
   }
@@ -2373,6 +2578,10 @@ struct Type<nu::TableModel> {
   static void NotifyRowInsertion(nu::TableModel* model, uint32_t row) {
     model->NotifyRowInsertion(row - 1);
   }
+  static void NotifyRowsInsertion(nu::TableModel* model,
+                                  uint32_t row, uint32_t count) {
+    model->NotifyRowsInsertion(row - 1, count);
+  }
   static void NotifyRowDeletion(nu::TableModel* model, uint32_t row) {
     model->NotifyRowDeletion(row - 1);
   }
@@ -2413,6 +2622,59 @@ struct Type<nu::SimpleTableModel> {
   }
 };
 
+template<>
+struct Type<nu::ColumnarTableModel::Column> {
+  static constexpr const char* name = "TableColumn";
+  static inline bool To(State* state, int index,
+                        nu::ColumnarTableModel::Column* out) {
+    if (GetType(state, index) != LuaType::Table)
+      return false;
+    // Read the packed array directly, the type of column is decided by the
+    // first element.
+    StackAutoReset reset(state);
+    size_t length = lua_rawlen(state, index);
+    lua_rawgeti(state, index, 1);
+    bool is_string = lua_type(state, -1) == LUA_TSTRING;
+    lua_pop(state, 1);
+    if (is_string) {
+      std::vector<std::string> strings(length);
+      for (size_t i = 0; i < length; ++i) {
+        lua_rawgeti(state, index, static_cast<int>(i + 1));
+        size_t size;
+        const char* str = lua_tolstring(state, -1, &size);
+        if (!str)
+          return false;
+        strings[i].assign(str, size);
+        lua_pop(state, 1);
+      }
+      *out = nu::ColumnarTableModel::Column(std::move(strings));
+    } else {
+      std::vector<double> numbers(length);
+      for (size_t i = 0; i < length; ++i) {
+        lua_rawgeti(state, index, static_cast<int>(i + 1));
+        int is_number = 0;
+        numbers[i] = lua_tonumberx(state, -1, &is_number);
+        if (!is_number)
+          return false;
+        lua_pop(state, 1);
+      }
+      *out = nu::ColumnarTableModel::Column(std::move(numbers));
+    }
+    return true;
+  }
+};
+
+template<>
+struct Type<nu::ColumnarTableModel> {
+  using Base = nu::TableModel;
+  static constexpr const char* name = "ColumnarTableModel";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "create", &CreateOnHeap<nu::ColumnarTableModel, uint32_t>,
+           "appendrows", &nu::ColumnarTableModel::AppendRows);
+  }
+};
+
 template<>
 struct Type<nu::Table::ColumnType> {
   static constexpr const char* name = "TableColumnType";
@@ -2506,6 +2768,18 @@ struct Type<nu::Table> {
   }
 };
 
+template<>
+struct Type<nu::TextEdit::TextDelta> {
+  static constexpr const char* name = "TextDelta";
+  static inline void Push(State* state, const nu::TextEdit::TextDelta& delta) {
+    lua::NewTable(state);
+    lua::RawSet(state, -1,
+                "offset", delta.offset,
+                "deletedlength", delta.deleted_length,
+                "insertedtext", delta.inserted_text);
+  }
+};
+
 template<>
 struct Type<nu::TextEdit> {
   using Base = nu::View;
@@ -2515,6 +2789,9 @@ struct Type<nu::TextEdit> {
            "create", &CreateOnHeap<nu::TextEdit>,
            "settext", &nu::TextEdit::SetText,
            "gettext", &nu::TextEdit::GetText,
+           "loadbuffer", &nu::TextEdit::LoadBuffer,
+           "loadfile", &nu::TextEdit::LoadFile,
+           "isloading", &nu::TextEdit::IsLoading,
            "redo", &nu::TextEdit::Redo,
            "canredo", &nu::TextEdit::CanRedo,
            "undo", &nu::TextEdit::Undo,
@@ -2526,6 +2803,7 @@ struct Type<nu::TextEdit> {
            "getselectionrange", &nu::TextEdit::GetSelectionRange,
            "selectrange", &nu::TextEdit::SelectRange,
            "gettextinrange", &nu::TextEdit::GetTextInRange,
+           "gettextlength", &nu::TextEdit::GetTextLength,
            "inserttext", &nu::TextEdit::InsertText,
            "inserttextat", &nu::TextEdit::InsertTextAt,
            "delete", &nu::TextEdit::Delete,
@@ -2541,6 +2819,7 @@ struct Type<nu::TextEdit> {
            "gettextbounds", &nu::TextEdit::GetTextBounds);
     RawSetProperty(state, metatable,
                    "ontextchange", &nu::TextEdit::on_text_change,
+                   "ontextdelta", &nu::TextEdit::on_text_delta,
                    "shouldinsertnewline",
                    &nu::TextEdit::should_insert_new_line);
   }
@@ -2762,6 +3041,57 @@ struct Type<nu::Vibrant> {
 };
 #endif
 
+// Read the style table at |index| and pass each property to |callback|.
+//
+// The keys are read in place, so no string is copied for property names and
+// numbers.
+template<typename T>
+bool ReadStyles(CallContext* context, int index, const T& callback) {
+  State* state = context->state;
+  if (GetType(state, index) != LuaType::Table) {
+    PushFormatedString(state, "The arg %d should be table", index);
+    context->has_error = true;
+    return false;
+  }
+  StackAutoReset reset(state);
+  std::string value;
+  PushNil(state);
+  while (lua_next(state, index) != 0) {
+    size_t size;
+    const char* key = lua_type(state, -2) == LUA_TSTRING ?
+        lua_tolstring(state, -2, &size) : nullptr;
+    if (key) {
+      nu::StyleProperty property =
+          nu::GetStyleProperty(::base::StringPiece(key, size));
+      if (lua_type(state, -1) == LUA_TNUMBER)
+        callback(property, static_cast<float>(lua_tonumber(state, -1)));
+      else if (lua::To(state, -1, &value))
+        callback(property, value);
+    }
+    PopAndIgnore(state, 1);
+  }
+  return true;
+}
+
+template<>
+struct Type<nu::StyleSheet> {
+  static constexpr const char* name = "StyleSheet";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "create", &Create,
+           "getsize", &nu::StyleSheet::GetSize);
+  }
+  static scoped_refptr<nu::StyleSheet> Create(CallContext* context) {
+    scoped_refptr<nu::StyleSheet> styles = new nu::StyleSheet;
+    if (!ReadStyles(context, 1, [&styles](nu::StyleProperty property,
+                                          const auto& value) {
+      styles->Set(property, value);
+    }))
+      return nullptr;
+    return styles;
+  }
+};
+
 template<>
 struct Type<nu::View> {
   using Base = nu::Responder;
@@ -2800,11 +3130,20 @@ struct Type<nu::View> {
            "setcolor", &nu::View::SetColor,
            "setbackgroundcolor", &nu::View::SetBackgroundColor,
            "setstyle", &SetStyle,
+           "setstyles", &nu::View::SetStyles,
            "getcomputedlayout", &nu::View::GetComputedLayout,
            "getminimumsize", &nu::View::GetMinimumSize,
+#if defined(OS_LINUX) || defined(OS_MAC)
+           "setopacity", &nu::View::SetOpacity,
+           "getopacity", &nu::View::GetOpacity,
+#endif
 #if defined(OS_MAC)
            "setwantslayer", &nu::View::SetWantsLayer,
            "wantslayer", &nu::View::WantsLayer,
+#endif
+#if defined(OS_LINUX)
+           "setcacheasbitmap", &nu::View::SetCacheAsBitmap,
+           "iscacheasbitmap", &nu::View::IsCacheAsBitmap,
 #endif
            "getparent", &nu::View::GetParent,
            "getwindow", &nu::View::GetWindow);
@@ -2817,10 +3156,12 @@ struct Type<nu::View> {
                    "handledragupdate", &nu::View::handle_drag_update,
                    "handledrop", &nu::View::handle_drop);
   }
-  static void SetStyle(nu::View* view,
-                       const std::map<std::string, std::string>& styles) {
-    for (const auto& it : styles)
-      view->SetStyleProperty(it.first, it.second);
+  static void SetStyle(CallContext* context, nu::View* view) {
+    if (!ReadStyles(context, 2, [view](nu::StyleProperty property,
+                                       const auto& value) {
+      view->SetStyleProperty(property, value);
+    }))
+      return;
     view->Layout();
   }
 };
@@ -2918,6 +3259,84 @@ struct Type<nu::Window> {
   }
 };
 
+namespace {
+
+// Runs the worker's chunk in a separate lua state on the worker thread.
+class WorkerRunner : public nu::Worker::Runner {
+ public:
+  explicit WorkerRunner(const std::string& chunk) {
+    luaL_openlibs(state_);
+    if (luaL_loadbuffer(state_, chunk.data(), chunk.size(), "=worker") !=
+        LUA_OK)
+      lua::Pop(state_, &error_);
+  }
+
+  // nu::Worker::Runner:
+  bool Run(::base::Value arg, ::base::Value* result) override {
+    if (!error_.empty()) {
+      *result = ::base::Value(error_);
+      return false;
+    }
+    // The loaded chunk always stays at index 1.
+    StackAutoReset reset(state_);
+    lua_pushvalue(state_, 1);
+    lua::Push(state_, arg);
+    if (lua_pcall(state_, 1, 1, 0) != LUA_OK) {
+      std::string error;
+      lua::To(state_, -1, &error);
+      *result = ::base::Value(std::move(error));
+      return false;
+    }
+    if (!lua::To(state_, -1, result)) {
+      *result = ::base::Value("error converting result of worker task");
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  ManagedState state_;
+  std::string error_;
+};
+
+}  // namespace
+
+template<>
+struct Type<nu::Worker> {
+  static constexpr const char* name = "Worker";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "create", &Create,
+           "posttask", &nu::Worker::PostTask,
+           "terminate", &nu::Worker::Terminate,
+           "getthreadcount", &nu::Worker::GetThreadCount);
+  }
+  static nu::Worker* Create(CallContext* context) {
+    State* state = context->state;
+    std::string chunk;
+    if (GetType(state, 1) == LuaType::Function) {
+      // Functions are passed to worker threads as bytecode, so they must not
+      // have upvalues.
+      lua_pushvalue(state, 1);
+      Dump(state, &chunk);
+      lua_pop(state, 1);
+    } else if (GetType(state, 1) == LuaType::String) {
+      size_t size = 0;
+      const char* str = lua_tolstring(state, 1, &size);
+      chunk.assign(str, size);
+    } else {
+      context->has_error = true;
+      Push(state, "Worker must be created with function or string");
+      return nullptr;
+    }
+    int threads = 0;
+    To(state, 2, &threads);
+    return new nu::Worker([chunk]() {
+      return std::make_unique<WorkerRunner>(chunk);
+    }, threads);
+  }
+};
+
 }  // namespace lua
 
 template<typename T>
@@ -2944,6 +3363,7 @@ extern "C" int luaopen_yue_gui(lua::State* state) {
   lua_rawset(state, -3);
 
   // Classes.
+  BindType<nu::Animation>(state, "Animation");
   BindType<nu::App>(state, "App");
   BindType<nu::Appearance>(state, "Appearance");
   BindType<nu::AttributedText>(state, "AttributedText");
@@ -2978,6 +3398,7 @@ extern "C" int luaopen_yue_gui(lua::State* state) {
   BindType<nu::Notification>(state, "Notification");
   BindType<nu::NotificationCenter>(state, "NotificationCenter");
   BindType<nu::Painter>(state, "Painter");
+  BindType<nu::Path>(state, "Path");
   BindType<nu::Picker>(state, "Picker");
   BindType<nu::ProgressBar>(state, "ProgressBar");
   BindType<nu::ProtocolAsarJob>(state, "ProtocolAsarJob");
@@ -2988,10 +3409,12 @@ extern "C" int luaopen_yue_gui(lua::State* state) {
   BindType<nu::Scroll>(state, "Scroll");
   BindType<nu::Separator>(state, "Separator");
   BindType<nu::Slider>(state, "Slider");
+  BindType<nu::StyleSheet>(state, "StyleSheet");
   BindType<nu::Tab>(state, "Tab");
   BindType<nu::TableModel>(state, "TableModel");
   BindType<nu::AbstractTableModel>(state, "AbstractTableModel");
   BindType<nu::SimpleTableModel>(state, "SimpleTableModel");
+  BindType<nu::ColumnarTableModel>(state, "ColumnarTableModel");
   BindType<nu::Table>(state, "Table");
   BindType<nu::TextEdit>(state, "TextEdit");
 #if defined(OS_MAC)
@@ -3003,6 +3426,7 @@ extern "C" int luaopen_yue_gui(lua::State* state) {
 #endif
   BindType<nu::View>(state, "View");
   BindType<nu::Window>(state, "Window");
+  BindType<nu::Worker>(state, "Worker");
   // Properties.
   lua::RawSet(state, -1,
               "app",                nu::App::GetCurrent(),
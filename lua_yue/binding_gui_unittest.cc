@@ -27,3 +27,31 @@ TEST_F(YueGuiTest, CollectGarbageInCallback) {
       "end)\n"
       "gui.MessageLoop.run()");
 }
+
+TEST_F(YueGuiTest, WorkerPostTask) {
+  ASSERT_FALSE(luaL_dostring(state_,
+      "local gui = require('yue.gui')\n"
+      "local worker = gui.Worker.create(function(n)\n"
+      "  local sum = 0\n"
+      "  for i = 1, n do sum = sum + i end\n"
+      "  return { sum = sum }\n"
+      "end, 2)\n"
+      "gui.MessageLoop.posttask(function()\n"
+      "  worker:posttask(100, function(success, result)\n"
+      "    assert(success)\n"
+      "    assert(result.sum == 5050)\n"
+      "    gui.MessageLoop.quit()\n"
+      "  end)\n"
+      "end)\n"
+      "gui.MessageLoop.run()"));
+}
+
+TEST_F(YueGuiTest, ColumnarTableModel) {
+  ASSERT_FALSE(luaL_dostring(state_,
+      "local gui = require('yue.gui')\n"
+      "local model = gui.ColumnarTableModel.create(2)\n"
+      "model:appendrows({ {1.5, 2.5, 3.5}, {'a', 'b', 'c'} })\n"
+      "assert(model:getrowcount() == 3)\n"
+      "assert(model:getvalue(1, 2) == 2.5)\n"
+      "assert(model:getvalue(2, 3) == 'c')"));
+}
@@ -5,6 +5,7 @@
 #ifndef LUA_YUE_BINDING_SIGNAL_H_
 #define LUA_YUE_BINDING_SIGNAL_H_
 
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -13,6 +14,78 @@
 
 namespace yue {
 
+// Push the weak table that references the handlers of signals.
+inline void PushSignalSlotsTable(lua::State* state) {
+  static char key;
+  lua_rawgetp(state, LUA_REGISTRYINDEX, &key);
+  if (lua::GetType(state, -1) != lua::LuaType::Table) {
+    lua::PopAndIgnore(state, 1);
+    lua::NewTable(state);
+    lua::NewTable(state);
+    lua::RawSet(state, -1, "__mode", "v");
+    lua::SetMetaTable(state, -2);
+    lua_pushvalue(state, -1);
+    lua_rawsetp(state, LUA_REGISTRYINDEX, &key);
+  }
+}
+
+// Calls the lua handler directly when the signal is emitted.
+//
+// Must not reference signal handler in C++: the slot only keeps a weak
+// reference, and the handler is kept alive by the __yuesignals table of the
+// signal's owner.
+template<typename Sig> class LuaSlot;
+
+template<typename ReturnType, typename... ArgTypes>
+class LuaSlot<ReturnType(ArgTypes...)>
+    : public nu::SignalSlot<ReturnType(ArgTypes...)> {
+ public:
+  LuaSlot(lua::State* state, int index) : state_(state) {
+    index = lua::AbsIndex(state, index);
+    lua::StackAutoReset reset(state);
+    PushSignalSlotsTable(state);
+    lua::RawSet(state, -1, static_cast<void*>(this),
+                lua::ValueOnStack(state, index));
+  }
+
+  ~LuaSlot() override {
+    lua::StackAutoReset reset(state_);
+    PushSignalSlotsTable(state_);
+    lua::RawSet(state_, -1, static_cast<void*>(this), nullptr);
+  }
+
+  LuaSlot& operator=(const LuaSlot&) = delete;
+  LuaSlot(const LuaSlot&) = delete;
+
+  // nu::SignalSlot:
+  ReturnType Call(ArgTypes... args) override {
+    PushSignalSlotsTable(state_);
+    lua::RawGet(state_, -1, static_cast<void*>(this));
+    lua_remove(state_, -2);
+    return lua::internal::PCallHelper<ReturnType, ArgTypes...>::RunOnTop(
+        state_, std::move(args)...);
+  }
+
+ private:
+  lua::State* state_;
+};
+
+// Connect the lua function at |index| to |signal|, and store the function in
+// the owner's __yuesignals table.
+template<typename Sig>
+int ConnectLuaSlot(lua::State* state, int owner, int index,
+                   nu::Signal<Sig>* signal) {
+  owner = lua::AbsIndex(state, owner);
+  index = lua::AbsIndex(state, index);
+  int id = signal->Connect(std::make_unique<LuaSlot<Sig>>(state, index));
+  // self.__yuesignals[signal][id] = slot
+  lua::StackAutoReset reset(state);
+  lua::PushRefsTable(state, "__yuesignals", owner);
+  lua::RawGetOrCreateTable(state, -1, static_cast<void*>(signal));
+  lua::RawSet(state, -1, id, lua::ValueOnStack(state, index));
+  return id;
+}
+
 // A simple structure that records the signal pointer and owner reference.
 template<typename Sig>
 class SignalWrapper : public base::RefCounted<SignalWrapper<Sig>> {
@@ -24,21 +97,14 @@ class SignalWrapper : public base::RefCounted<SignalWrapper<Sig>> {
   int Connect(lua::CallContext* context) {
     if (!PushOwner(context))
       return -1;
-    // Must not reference signal handler in C++.
-    std::function<Sig> slot;
-    if (!lua::ToWeakFunction(context->state, 2, &slot)) {
+    if (lua::GetType(context->state, 2) != lua::LuaType::Function) {
       context->has_error = true;
       lua::PushFormatedString(
           context->state, "error converting arg at index %d from %s to %s",
           2, lua::GetTypeName(context->state, 2), "function");
       return -1;
     }
-    int id = signal_->Connect(std::move(slot));
-    // self.__yuesignals[signal][id] = slot
-    lua::PushRefsTable(context->state, "__yuesignals", -1);
-    lua::RawGetOrCreateTable(context->state, -1, static_cast<void*>(signal_));
-    lua::RawSet(context->state, -1, id, lua::ValueOnStack(context->state, 2));
-    return id;
+    return ConnectLuaSlot(context->state, -1, 2, signal_);
   }
 
   void Disconnect(lua::CallContext* context, int id) {
@@ -114,15 +180,7 @@ struct MemberTraits<nu::Signal<Sig>> {
                         nu::Signal<Sig>* out) {
     if (lua::GetType(state, value) != lua::LuaType::Function)
       return false;
-    // Must not reference signal handler in C++.
-    std::function<Sig> slot;
-    if (!lua::ToWeakFunction(state, value, &slot))
-      return false;
-    int id = out->Connect(std::move(slot));
-    // self.__yuesignals[signal][id] = slot
-    lua::PushRefsTable(state, "__yuesignals", owner);
-    lua::RawGetOrCreateTable(state, -1, static_cast<void*>(out));
-    lua::RawSet(state, -1, id, lua::ValueOnStack(state, value));
+    yue::ConnectLuaSlot(state, owner, value, out);
     return true;
   }
 };
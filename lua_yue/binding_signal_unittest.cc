@@ -65,6 +65,18 @@ TEST_F(YueSignalTest, DisconnectAll) {
   EXPECT_FALSE(closed);
 }
 
+TEST_F(YueSignalTest, DisconnectInSlot) {
+  ASSERT_FALSE(luaL_dostring(state_,
+      "count = 0\n"
+      "win.onclose:connect(function()\n"
+      "  count = count + 1\n"
+      "  win.onclose:disconnectall()\n"
+      "end)\n"
+      "win.onclose:connect(function() count = count + 10 end)\n"
+      "win:close()\n"
+      "assert(count == 1)"));
+}
+
 TEST_F(YueSignalTest, Cached) {
   ASSERT_FALSE(luaL_dostring(state_, "return win.onclose"));
   ASSERT_FALSE(luaL_dostring(state_, "return win.onclose"));
@@ -4,29 +4,100 @@
 
 #include "lua_yue/binding_values.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base/memory/ptr_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 
 namespace lua {
 
 namespace {
 
-// Check if a table is array.
-bool IsTableArray(State* state, int index, size_t* size) {
+// Lua strings can hold arbitrary bytes while base::Value only stores UTF-8
+// strings, so other strings are converted to BINARY.
+base::Value StringToValue(State* state, int index) {
+  size_t size = 0;
+  const char* str = lua_tolstring(state, index, &size);
+  base::StringPiece piece(str, size);
+  if (base::IsStringUTF8AllowingNoncharacters(piece))
+    return base::Value(piece);
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(str);
+  return base::Value(base::Value::BlobStorage(data, data + size));
+}
+
+// Convert the table key without modifying it, since calling lua_tolstring on
+// a number key would confuse lua_next.
+bool KeyToString(State* state, int index, std::string* out) {
+  switch (GetType(state, index)) {
+    case LuaType::String: {
+      size_t size = 0;
+      const char* str = lua_tolstring(state, index, &size);
+      out->assign(str, size);
+      return true;
+    }
+    case LuaType::Number: {
+      lua_pushvalue(state, index);
+      size_t size = 0;
+      const char* str = lua_tolstring(state, -1, &size);
+      out->assign(str, size);
+      lua_pop(state, 1);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Convert table in one pass: values are appended to a list as long as the
+// keys are 1, 2, 3..., and the table is treated as dictionary once any other
+// key is met.
+bool TableToValue(State* state, int index, base::Value* out) {
   StackAutoReset reset(state);
-  *size = 0;
+  base::Value::List list;
+  list.reserve(RawLen(state, index));
+  std::vector<std::pair<std::string, base::Value>> entries;
+  bool is_array = true;
   lua_pushnil(state);
   while (lua_next(state, index) != 0) {
-    if (GetType(state, -2) != LuaType::Number ||  // check array type
-        lua_tointeger(state, -2) != static_cast<int>(*size + 1))
+    base::Value value;
+    if (!Type<base::Value>::To(state, -1, &value))
       return false;
-    (*size)++;
+    if (is_array &&
+        GetType(state, -2) == LuaType::Number &&
+        lua_tointeger(state, -2) == static_cast<lua_Integer>(list.size() + 1)) {
+      list.Append(std::move(value));
+    } else {
+      if (is_array) {
+        is_array = false;
+        entries.reserve(list.size() + 1);
+        for (size_t i = 0; i < list.size(); ++i)
+          entries.emplace_back(base::NumberToString(i + 1), std::move(list[i]));
+        list.clear();
+      }
+      std::string key;
+      if (!KeyToString(state, -2, &key))
+        return false;
+      entries.emplace_back(std::move(key), std::move(value));
+    }
     lua_pop(state, 1);
   }
+  if (is_array) {
+    *out = base::Value(std::move(list));
+    return true;
+  }
+  // Inserting sorted keys only appends to the underlying flat map of Dict,
+  // while inserting in the order of lua_next would be quadratic.
+  std::sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+  base::Value::Dict dict;
+  for (auto& it : entries)
+    dict.Set(it.first, std::move(it.second));
+  *out = base::Value(std::move(dict));
   return true;
 }
 
@@ -65,11 +136,11 @@ void Type<base::Value>::Push(State* state, const base::Value& value) {
       return;
     }
     case base::Value::Type::LIST: {
-      NewTable(state, static_cast<int>(value.GetList().size()), 0);
-      for (size_t i = 0; i < value.GetList().size(); ++i) {
-        lua::Push(state, static_cast<int>(i + 1));
+      int size = static_cast<int>(value.GetList().size());
+      NewTable(state, size, 0);
+      for (int i = 0; i < size; ++i) {
         Type<base::Value>::Push(state, value.GetList()[i]);
-        lua_rawset(state, -3);
+        lua_rawseti(state, -2, i + 1);
       }
       return;
     }
@@ -90,39 +161,15 @@ bool Type<base::Value>::To(State* state, int index, base::Value* out) {
       *out = base::Value(lua_toboolean(state, index));
       break;
     case LuaType::String:
-      *out = base::Value(lua_tostring(state, index));
+      *out = StringToValue(state, index);
       break;
-    case LuaType::Table: {
-      size_t size = 0;
-      if (IsTableArray(state, index, &size)) {
-        std::vector<base::Value> list;
-        if (!lua::To(state, index, &list))
-          return false;
-        base::Value::List storage;
-        storage.reserve(list.size());
-        for (auto& it : list)
-          storage.Append(std::move(it));
-        *out = base::Value(std::move(storage));
-      } else {
-        *out = base::Value(base::Value::Type::DICT);
-        StackAutoReset reset(state);
-        lua_pushnil(state);
-        while (lua_next(state, index) != 0) {
-          std::string key;
-          base::Value value;
-          if (!lua::To(state, -2, &key) || !lua::To(state, -1, &value))
-            return false;
-          lua_pop(state, 1);
-          out->GetDict().Set(key.c_str(), std::move(value));
-        }
-      }
-      break;
-    }
+    case LuaType::Table:
+      return TableToValue(state, index, out);
     default:
       *out = base::Value();
       break;
   }
-  return true;;
+  return true;
 }
 
 // static
@@ -0,0 +1,35 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <iostream>
+
+#include "base/timer/elapsed_timer.h"
+#include "lua_yue/binding_values.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class YueValuesPerfTest : public testing::Test {
+ protected:
+  lua::ManagedState state_;
+};
+
+TEST_F(YueValuesPerfTest, ConvertLargeTable) {
+  ASSERT_FALSE(luaL_dostring(state_,
+      "local rows = {}\n"
+      "for i = 1, 100000 do\n"
+      "  rows[i] = { id = i, name = 'row' .. i, value = i / 3 }\n"
+      "end\n"
+      "return rows"));
+  base::ElapsedTimer timer;
+  base::Value out;
+  ASSERT_TRUE(lua::To(state_, 1, &out));
+  base::TimeDelta to_value = timer.Elapsed();
+  ASSERT_EQ(out.GetList().size(), 100000u);
+  timer = base::ElapsedTimer();
+  lua::Push(state_, out);
+  base::TimeDelta to_lua = timer.Elapsed();
+  ASSERT_EQ(lua::RawLen(state_, 2), 100000u);
+  std::cout << "Lua table -> base::Value: " << to_value.InMilliseconds()
+            << "ms, base::Value -> Lua table: " << to_lua.InMilliseconds()
+            << "ms" << std::endl;
+}
@@ -35,3 +35,22 @@ TEST_F(YueValuesTest, ValueConversions) {
   ASSERT_TRUE(base::JSONWriter::Write(out, &json));
   ASSERT_EQ(json, "{\"a\":" ONE ",\"b\":{\"c\":[\"t\",\"e\"],\"d\":\"st\"}}");
 }
+
+TEST_F(YueValuesTest, MixedTable) {
+  ASSERT_FALSE(luaL_dostring(state_, "return { 't', 'e', [4] = 's', x = 1 }"));
+  base::Value out;
+  ASSERT_TRUE(lua::To(state_, 1, &out));
+  std::string json;
+  ASSERT_TRUE(base::JSONWriter::Write(out, &json));
+  ASSERT_EQ(json, "{\"1\":\"t\",\"2\":\"e\",\"4\":\"s\",\"x\":1}");
+}
+
+TEST_F(YueValuesTest, BinaryString) {
+  ASSERT_FALSE(luaL_dostring(state_, "return '\\0\\255\\1'"));
+  base::Value out;
+  ASSERT_TRUE(lua::To(state_, 1, &out));
+  ASSERT_TRUE(out.is_blob());
+  EXPECT_EQ(out.GetBlob(), base::Value::BlobStorage({0, 255, 1}));
+  lua::Push(state_, out);
+  EXPECT_TRUE(lua::Compare(state_, 1, 2, lua::CompareOp::EQ));
+}
@@ -8,9 +8,13 @@
 #include <string>
 #include <utility>
 
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/strings/string_util.h"
 #include "lua_yue/binding_gui.h"
 #include "lua_yue/binding_sys.h"
 #include "lua_yue/binding_util.h"
+#include "nativeui/asar_archive.h"
 
 #if LUA_VERSION_NUM >= 502
 # define PACKAGE_SEARCHERS "searchers"
@@ -58,10 +62,81 @@ int SearchBuiltin(lua::State* state) {
   }
 }
 
-}  // namespace
+// Modules packed in an asar archive.
+class ArchiveModules {
+ public:
+  explicit ArchiveModules(const base::FilePath& path)
+      : archive_(base::File(path, base::File::FLAG_OPEN |
+                                  base::File::FLAG_READ),
+                 false /* extended_format */),
+        chunk_prefix_("@" + path.AsUTF8Unsafe() + "/") {
+    if (archive_.IsValid())
+      mapped_file_.Initialize(path);
+  }
 
-void InsertBuiltinModuleLoader(lua::State* state) {
+  ArchiveModules& operator=(const ArchiveModules&) = delete;
+  ArchiveModules(const ArchiveModules&) = delete;
+
+  bool IsValid() const {
+    return archive_.IsValid() && mapped_file_.IsValid();
+  }
+
+  // Push the loaded chunk and its file name on success, push an error message
+  // when the module is not found, and return -1 when there is a load error.
+  int Load(lua::State* state, const std::string& name) {
+    std::string path;
+    base::ReplaceChars(name, ".", "/", &path);
+    for (const char* suffix : {".lua", "/init.lua"}) {
+      std::string file = path + suffix;
+      nu::AsarArchive::FileInfo info;
+      if (!archive_.GetFileInfo(file, &info))
+        continue;
+      std::string chunk_name = chunk_prefix_ + file;
+      if (info.offset + info.size > mapped_file_.length()) {
+        lua::PushFormatedString(state, "corrupted archive file '%s'",
+                                chunk_name.c_str() + 1);
+        return -1;
+      }
+      // The data is read from mapped memory directly, luaL_loadbuffer is able
+      // to tell bytecode from source code.
+      const char* data =
+          reinterpret_cast<const char*>(mapped_file_.data()) + info.offset;
+      if (luaL_loadbuffer(state, data, info.size, chunk_name.c_str()) !=
+          LUA_OK)
+        return -1;
+      lua::Push(state, chunk_name.substr(1));
+      return 2;
+    }
+    lua::PushFormatedString(state, "\n\tno file '%s' in archive",
+                            path.c_str());
+    return 1;
+  }
+
+ private:
+  nu::AsarArchive archive_;
+  base::MemoryMappedFile mapped_file_;
+  std::string chunk_prefix_;
+};
+
+int SearchArchive(lua::State* state) {
+  auto* modules = static_cast<ArchiveModules*>(
+      lua_touserdata(state, lua_upvalueindex(1)));
+  int results;
+  {
+    std::string name;
+    lua::To(state, 1, &name);
+    results = modules->Load(state, name);
+  }
+  // Raise error after all C++ objects are destroyed.
+  if (results < 0)
+    return lua_error(state);
+  return results;
+}
+
+// Insert the function on the top of stack to package.searchers at |index|.
+void InsertSearcher(lua::State* state, int index) {
   lua::StackAutoReset reset(state);
+  int searcher = lua_gettop(state);
   lua_getglobal(state, "package");
   CHECK_EQ(lua::GetType(state, -1), lua::LuaType::Table)
       << "package should be a table";
@@ -69,13 +144,36 @@ void InsertBuiltinModuleLoader(lua::State* state) {
   CHECK_EQ(lua::GetType(state, -1), lua::LuaType::Table)
       << "package." PACKAGE_SEARCHERS " should be a table";
 
-  // table.insert(pacakge.searchers, 2, search_builtin)
+  // table.insert(pacakge.searchers, index, searcher)
   int len = static_cast<int>(lua::RawLen(state, -1));
-  for (int i = len; i >= 2; --i) {
+  for (int i = len; i >= index; --i) {
     lua::RawGet(state, -1, i);
     lua_rawseti(state, -2, i + 1);
   }
-  lua::RawSet(state, -1, 2, lua::CFunction(&SearchBuiltin));
+  lua_pushvalue(state, searcher);
+  lua_rawseti(state, -2, index);
+}
+
+}  // namespace
+
+void InsertBuiltinModuleLoader(lua::State* state) {
+  lua::Push(state, lua::CFunction(&SearchBuiltin));
+  InsertSearcher(state, 2);
+  lua_pop(state, 1);
+}
+
+bool InsertArchiveModuleLoader(lua::State* state,
+                               const base::FilePath& path) {
+  lua::NewUserData<ArchiveModules>(state, path);
+  if (!static_cast<ArchiveModules*>(lua_touserdata(state, -1))->IsValid()) {
+    lua_pop(state, 1);
+    return false;
+  }
+  // Modules in archive take priority over the ones in filesystem.
+  lua_pushcclosure(state, &SearchArchive, 1);
+  InsertSearcher(state, 2);
+  lua_pop(state, 1);
+  return true;
 }
 
 }  // namespace yue
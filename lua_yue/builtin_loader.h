@@ -7,11 +7,22 @@
 
 #include "lua/lua.h"
 
+namespace base {
+class FilePath;
+}
+
 namespace yue {
 
 // Add a function to package.searchers to load builtin modules of yue.
 void InsertBuiltinModuleLoader(lua::State* state);
 
+// Add a function to package.searchers to load modules from an asar archive.
+//
+// The archive is memory mapped, and a module is only loaded when it is
+// required for the first time. The modules can be either source code or
+// precompiled bytecode.
+bool InsertArchiveModuleLoader(lua::State* state, const base::FilePath& path);
+
 }  // namespace yue
 
 #endif  // LUA_YUE_BUILTIN_LOADER_H_
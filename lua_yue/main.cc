@@ -3,8 +3,10 @@
 // LICENSE file.
 
 #include "base/command_line.h"
+#include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/strings/utf_string_conversions.h"
+#include "lua_yue/app_bundle.h"
 #include "lua_yue/builtin_loader.h"
 #include "nativeui/lifetime.h"
 #include "nativeui/state.h"
@@ -14,8 +16,24 @@ int main(int argc, const char *argv[]) {
   base::CommandLine::Init(argc, argv);
 
   auto* cmd = base::CommandLine::ForCurrentProcess();
+
+  // Pack an app into asar archive.
+  if (cmd->HasSwitch("bundle")) {
+    if (cmd->GetArgs().size() != 1) {
+      fprintf(stderr, "Usage: yue --bundle=<app-dir> <path-to-asar>\n");
+      return 1;
+    }
+    std::string error;
+    if (!yue::CreateAppBundle(cmd->GetSwitchValuePath("bundle"),
+                              base::FilePath(cmd->GetArgs()[0]), &error)) {
+      fprintf(stderr, "Error when bundling app: %s\n", error.c_str());
+      return 1;
+    }
+    return 0;
+  }
+
   if (cmd->GetArgs().size() != 1) {
-    fprintf(stderr, "Usage: yue <path-to-script>\n");
+    fprintf(stderr, "Usage: yue <path-to-script-or-asar>\n");
     return 1;
   }
 
@@ -38,9 +56,25 @@ int main(int argc, const char *argv[]) {
   std::string filename = cmd->GetArgs()[0];
 #endif
 
+  // When running an app bundle, load modules from the archive and run the
+  // "main" module in it.
+  base::FilePath path(cmd->GetArgs()[0]);
+  bool is_bundle = path.MatchesExtension(FILE_PATH_LITERAL(".asar"));
+  if (is_bundle && !yue::InsertArchiveModuleLoader(state, path)) {
+    fprintf(stderr, "Unable to read archive: %s\n", filename.c_str());
+    return 1;
+  }
+
   // Load the main script.
-  if (luaL_loadfile(state, filename.c_str()) != LUA_OK ||
-      !lua::PCall(state, nullptr)) {
+  bool success;
+  if (is_bundle) {
+    lua_getglobal(state, "require");
+    success = lua::PCall(state, nullptr, "main");
+  } else {
+    success = luaL_loadfile(state, filename.c_str()) == LUA_OK &&
+              lua::PCall(state, nullptr);
+  }
+  if (!success) {
     std::string error;
     lua::Pop(state, &error);
     fprintf(stderr, "Error when running script: %s\n", error.c_str());
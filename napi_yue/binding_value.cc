@@ -4,7 +4,7 @@
 
 #include "napi_yue/binding_value.h"
 
-#include <map>
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,6 +13,129 @@
 
 namespace ki {
 
+size_t TypedArrayElementSize(napi_typedarray_type type) {
+  switch (type) {
+    case napi_int8_array:
+    case napi_uint8_array:
+    case napi_uint8_clamped_array:
+      return 1;
+    case napi_int16_array:
+    case napi_uint16_array:
+      return 2;
+    case napi_int32_array:
+    case napi_uint32_array:
+    case napi_float32_array:
+      return 4;
+    case napi_float64_array:
+    case napi_bigint64_array:
+    case napi_biguint64_array:
+      return 8;
+  }
+  NOTREACHED();
+  return 1;
+}
+
+namespace {
+
+// Copy the bytes viewed by TypedArray/DataView/Buffer/ArrayBuffer to BINARY.
+bool BinaryToValue(napi_env env, napi_value value, base::Value* out) {
+  void* data = nullptr;
+  size_t length = 0;
+  bool result = false;
+  if (napi_is_typedarray(env, value, &result) == napi_ok && result) {
+    napi_typedarray_type type;
+    size_t count;
+    napi_value buffer;
+    size_t offset;
+    if (napi_get_typedarray_info(env, value, &type, &count, &data, &buffer,
+                                 &offset) != napi_ok)
+      return false;
+    length = count * TypedArrayElementSize(type);
+  } else if (napi_is_dataview(env, value, &result) == napi_ok && result) {
+    napi_value buffer;
+    size_t offset;
+    if (napi_get_dataview_info(env, value, &length, &data, &buffer,
+                               &offset) != napi_ok)
+      return false;
+  } else if (napi_is_arraybuffer(env, value, &result) == napi_ok && result) {
+    if (napi_get_arraybuffer_info(env, value, &data, &length) != napi_ok)
+      return false;
+  } else {
+    return false;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  *out = base::Value(base::Value::BlobStorage(bytes, bytes + length));
+  return true;
+}
+
+// Convert array by appending elements to the list directly.
+napi_status ArrayToValue(napi_env env, napi_value value, base::Value* out) {
+  uint32_t length = 0;
+  napi_status s = napi_get_array_length(env, value, &length);
+  if (s != napi_ok)
+    return s;
+  base::Value::List list;
+  list.reserve(length);
+  for (uint32_t i = 0; i < length; ++i) {
+    napi_value element;
+    s = napi_get_element(env, value, i, &element);
+    if (s != napi_ok)
+      return s;
+    base::Value item;
+    s = ConvertFromNode(env, element, &item);
+    if (s != napi_ok)
+      return s;
+    list.Append(std::move(item));
+  }
+  *out = base::Value(std::move(list));
+  return napi_ok;
+}
+
+// Convert object by collecting the properties into a vector first, inserting
+// sorted keys only appends to the underlying flat map of Dict.
+napi_status DictToValue(napi_env env, napi_value value, base::Value* out) {
+  napi_value names;
+  napi_status s = napi_get_property_names(env, value, &names);
+  if (s != napi_ok)
+    return s;
+  uint32_t length = 0;
+  s = napi_get_array_length(env, names, &length);
+  if (s != napi_ok)
+    return s;
+  std::vector<std::pair<std::string, base::Value>> entries;
+  entries.reserve(length);
+  for (uint32_t i = 0; i < length; ++i) {
+    napi_value key;
+    napi_value property;
+    if ((s = napi_get_element(env, names, i, &key)) != napi_ok ||
+        (s = napi_get_property(env, value, key, &property)) != napi_ok)
+      return s;
+    std::string name;
+    base::Value item;
+    if ((s = ConvertFromNode(env, key, &name)) != napi_ok ||
+        (s = ConvertFromNode(env, property, &item)) != napi_ok)
+      return s;
+    entries.emplace_back(std::move(name), std::move(item));
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+  base::Value::Dict dict;
+  for (auto& it : entries)
+    dict.Set(it.first, std::move(it.second));
+  *out = base::Value(std::move(dict));
+  return napi_ok;
+}
+
+napi_status ObjectToValue(napi_env env, napi_value value, base::Value* out) {
+  if (IsArray(env, value))
+    return ArrayToValue(env, value, out);
+  if (BinaryToValue(env, value, out))
+    return napi_ok;
+  return DictToValue(env, value, out);
+}
+
+}  // namespace
+
 // static
 napi_status Type<base::Value>::ToNode(napi_env env,
                                       const base::Value& value,
@@ -83,26 +206,7 @@ napi_status Type<base::Value>::FromNode(napi_env env,
       *out = base::Value(FromNodeTo<std::string>(env, value));
       break;
     case napi_object:
-      if (IsArray(env, value)) {
-        std::vector<base::Value> list;
-        s = ConvertFromNode(env, value, &list);
-        if (s != napi_ok) break;
-        base::Value::List storage;
-        storage.reserve(list.size());
-        for (auto& it : list)
-          storage.Append(std::move(it));
-        *out = base::Value(std::move(storage));
-        break;
-      } else {
-        std::map<std::string, base::Value> map;
-        s = ConvertFromNode(env, value, &map);
-        if (s != napi_ok) break;
-        base::Value::Dict storage;
-        for (auto& it : map)
-          storage.Set(it.first, std::move(it.second));
-        *out = base::Value(std::move(storage));
-        break;
-      }
+      s = ObjectToValue(env, value, out);
       break;
     default:
       NOTREACHED() << "Unsupported JavaScript type: "
@@ -10,6 +10,9 @@
 
 namespace ki {
 
+// Return the size in bytes of each element of the TypedArray |type|.
+size_t TypedArrayElementSize(napi_typedarray_type type);
+
 template<>
 struct Type<base::Value> {
   static constexpr const char* name = "Value";
@@ -118,7 +118,24 @@ struct Type<nu::Buffer> {
   static napi_status FromNode(napi_env env, napi_value value, nu::Buffer* out) {
     void* data;
     size_t length;
-    napi_status s = napi_get_arraybuffer_info(env, value, &data, &length);
+    bool is_buffer = false;
+    bool is_typedarray = false;
+    napi_status s = napi_is_buffer(env, value, &is_buffer);
+    if (s == napi_ok && !is_buffer)
+      s = napi_is_typedarray(env, value, &is_typedarray);
+    if (s != napi_ok)
+      return s;
+    if (is_buffer) {
+      s = napi_get_buffer_info(env, value, &data, &length);
+    } else if (is_typedarray) {
+      // Views like Float32Array are passed without copying.
+      napi_typedarray_type type;
+      s = napi_get_typedarray_info(env, value, &type, &length, &data,
+                                   nullptr, nullptr);
+      length *= TypedArrayElementSize(type);
+    } else {
+      s = napi_get_arraybuffer_info(env, value, &data, &length);
+    }
     // We are assuming the Buffer is consumed immediately.
     if (s == napi_ok)
       *out = nu::Buffer::Wrap(data, length);
@@ -182,6 +199,29 @@ struct Type<nu::Size> {
   }
 };
 
+template<>
+struct Type<nu::Rect> {
+  static constexpr const char* name = "Rect";
+  static napi_status ToNode(napi_env env,
+                            const nu::Rect& value,
+                            napi_value* result) {
+    *result = CreateObject(env);
+    Set(env, *result,
+        "x", value.x(), "y", value.y(),
+        "width", value.width(), "height", value.height());
+    return napi_ok;
+  }
+  static napi_status FromNode(napi_env env, napi_value value, nu::Rect* out) {
+    int x = 0, y = 0, width = 0, height = 0;
+    if (!ReadOptions(env, value,
+                     "x", &x, "y", &y,
+                     "width", &width, "height", &height))
+      return napi_invalid_arg;
+    *out = nu::Rect(x, y, width, height);
+    return napi_ok;
+  }
+};
+
 template<>
 struct Type<nu::SizeF> {
   static constexpr const char* name = "SizeF";
@@ -566,6 +606,88 @@ struct Type<nu::TextAttributes> {
   }
 };
 
+template<>
+struct Type<nu::Animation::Easing> {
+  static constexpr const char* name = "AnimationEasing";
+  static napi_status ToNode(napi_env env,
+                            nu::Animation::Easing easing,
+                            napi_value* result) {
+    switch (easing) {
+      case nu::Animation::Easing::Linear:
+        return ConvertToNode(env, "linear", result);
+      case nu::Animation::Easing::Ease:
+        return ConvertToNode(env, "ease", result);
+      case nu::Animation::Easing::EaseIn:
+        return ConvertToNode(env, "ease-in", result);
+      case nu::Animation::Easing::EaseOut:
+        return ConvertToNode(env, "ease-out", result);
+      case nu::Animation::Easing::EaseInOut:
+        return ConvertToNode(env, "ease-in-out", result);
+    }
+    NOTREACHED();
+    return napi_generic_failure;
+  }
+  static napi_status FromNode(napi_env env,
+                              napi_value value,
+                              nu::Animation::Easing* out) {
+    std::string easing;
+    napi_status s = ConvertFromNode(env, value, &easing);
+    if (s == napi_ok) {
+      if (easing == "linear")
+        *out = nu::Animation::Easing::Linear;
+      else if (easing == "ease")
+        *out = nu::Animation::Easing::Ease;
+      else if (easing == "ease-in")
+        *out = nu::Animation::Easing::EaseIn;
+      else if (easing == "ease-out")
+        *out = nu::Animation::Easing::EaseOut;
+      else if (easing == "ease-in-out")
+        *out = nu::Animation::Easing::EaseInOut;
+      else
+        return napi_invalid_arg;
+    }
+    return s;
+  }
+};
+
+template<>
+struct Type<nu::Animation> {
+  static constexpr const char* name = "Animation";
+  static void Define(napi_env env,
+                     napi_value constructor,
+                     napi_value prototype) {
+    Set(env, constructor,
+        "create", &CreateOnHeap<nu::Animation, int>);
+    Set(env, prototype,
+        "setDuration", &nu::Animation::SetDuration,
+        "getDuration", &nu::Animation::GetDuration,
+        "setDelay", &nu::Animation::SetDelay,
+        "getDelay", &nu::Animation::GetDelay,
+        "setEasing", &nu::Animation::SetEasing,
+        "getEasing", &nu::Animation::GetEasing,
+        "animateBounds", &nu::Animation::AnimateBounds,
+        "animateColor", &nu::Animation::AnimateColor,
+        "animateBackgroundColor", &nu::Animation::AnimateBackgroundColor,
+        "animateStyle", &AnimateStyle,
+#if defined(OS_LINUX) || defined(OS_MAC)
+        "animateOpacity", &nu::Animation::AnimateOpacity,
+#endif
+        "clear", &nu::Animation::Clear,
+        "start", &nu::Animation::Start,
+        "stop", &nu::Animation::Stop,
+        "isRunning", &nu::Animation::IsRunning);
+    DefineProperties(env, prototype,
+                     Signal("onFinish", &nu::Animation::on_finish));
+  }
+  static void AnimateStyle(nu::Animation* animation,
+                           nu::View* view,
+                           const std::string& name,
+                           float from,
+                           float to) {
+    animation->AnimateStyle(view, name, from, to);
+  }
+};
+
 #if defined(OS_MAC)
 template<>
 struct Type<nu::App::ActivationPolicy> {
@@ -936,7 +1058,11 @@ struct Type<nu::Canvas> {
     Set(env, prototype,
         "getScaleFactor", &nu::Canvas::GetScaleFactor,
         "getPainter", &nu::Canvas::GetPainter,
-        "getSize", &nu::Canvas::GetSize);
+        "getSize", &nu::Canvas::GetSize,
+        "resize", &nu::Canvas::Resize,
+        "getPixelSize", &nu::Canvas::GetPixelSize,
+        "getImageData", &nu::Canvas::GetImageData,
+        "putImageData", &nu::Canvas::PutImageData);
   }
 };
 
@@ -1208,7 +1334,9 @@ struct Type<nu::Container> {
           AttachedTable(args).Delete(args[0]);
         }),
         "childCount", &nu::Container::ChildCount,
-        "childAt", &nu::Container::ChildAt);
+        "childAt", &nu::Container::ChildAt,
+        "setUseDisplayList", &nu::Container::SetUseDisplayList,
+        "isUsingDisplayList", &nu::Container::IsUsingDisplayList);
     DefineProperties(
         env, prototype,
         Signal("onDraw", &nu::Container::on_draw));
@@ -1637,9 +1765,8 @@ struct Type<nu::Font> {
                      napi_value constructor,
                      napi_value prototype) {
     Set(env, constructor,
-        "create", &CreateOnHeap<nu::Font, const std::string&, float,
-                                nu::Font::Weight, nu::Font::Style>,
-        "createFromPath", &CreateOnHeap<nu::Font, const base::FilePath&, float>,
+        "create", &nu::Font::Get,
+        "createFromPath", &nu::Font::GetFromPath,
         "default", &nu::Font::Default);
     Set(env, prototype,
         "derive", &nu::Font::Derive,
@@ -1702,6 +1829,44 @@ struct Type<nu::Group> {
   }
 };
 
+template<>
+struct Type<nu::Image::Format> {
+  static constexpr const char* name = "ImageFormat";
+  static napi_status FromNode(napi_env env,
+                              napi_value value,
+                              nu::Image::Format* out) {
+    std::string format;
+    napi_status s = ConvertFromNode(env, value, &format);
+    if (s == napi_ok) {
+      if (format == "png")
+        *out = nu::Image::Format::PNG;
+      else if (format == "jpeg")
+        *out = nu::Image::Format::JPEG;
+      else if (format == "qoi")
+        *out = nu::Image::Format::QOI;
+      else
+        return napi_invalid_arg;
+    }
+    return s;
+  }
+};
+
+template<>
+struct Type<nu::Image::EncodeOptions> {
+  static constexpr const char* name = "ImageEncodeOptions";
+  static napi_status FromNode(napi_env env,
+                              napi_value value,
+                              nu::Image::EncodeOptions* out) {
+    if (!ReadOptions(env, value,
+                     "format", &out->format,
+                     "compression", &out->compression,
+                     "quality", &out->quality,
+                     "progressive", &out->progressive))
+      return napi_invalid_arg;
+    return napi_ok;
+  }
+};
+
 template<>
 struct Type<nu::Image> {
   static constexpr const char* name = "Image";
@@ -1723,7 +1888,9 @@ struct Type<nu::Image> {
         "tint", &nu::Image::Tint,
         "resize", &nu::Image::Resize,
         "toPNG", &nu::Image::ToPNG,
-        "toJPEG", &nu::Image::ToJPEG);
+        "toJPEG", &nu::Image::ToJPEG,
+        "encode", &nu::Image::Encode,
+        "encodeToFile", &nu::Image::EncodeToFile);
   }
 };
 
@@ -2286,13 +2453,65 @@ struct Type<nu::Painter> {
         "clear", &nu::Painter::Clear,
         "strokeRect", &nu::Painter::StrokeRect,
         "fillRect", &nu::Painter::FillRect,
+        "fillPath", &nu::Painter::FillPath,
+        "strokePath", &nu::Painter::StrokePath,
+        "fillRects", &FillRects,
+        "strokePolyline", &nu::Painter::StrokePolyline,
+        "drawPoints", &DrawPoints,
         "drawImage", &nu::Painter::DrawImage,
         "drawImageFromRect", &nu::Painter::DrawImageFromRect,
         "drawCanvas", &nu::Painter::DrawCanvas,
         "drawCanvasFromRect", &nu::Painter::DrawCanvasFromRect,
         "drawAttributedText", &nu::Painter::DrawAttributedText,
+        "getDirtyRects", &nu::Painter::GetDirtyRects,
+        "isRectDirty", &nu::Painter::IsRectDirty,
+#if defined(OS_LINUX)
+        "setUseGlyphAtlas", &nu::Painter::SetUseGlyphAtlas,
+#endif
         "drawText", &nu::Painter::DrawText);
   }
+  static void FillRects(nu::Painter* painter,
+                        const nu::Buffer& rects,
+                        absl::optional<nu::Buffer> colors) {
+    if (colors)
+      painter->FillRects(rects, *colors);
+    else
+      painter->FillRects(rects, nu::Buffer());
+  }
+  static void DrawPoints(nu::Painter* painter,
+                         const nu::Buffer& points,
+                         float diameter,
+                         absl::optional<nu::Buffer> colors) {
+    if (colors)
+      painter->DrawPoints(points, diameter, *colors);
+    else
+      painter->DrawPoints(points, diameter, nu::Buffer());
+  }
+};
+
+template<>
+struct Type<nu::Path> {
+  static constexpr const char* name = "Path";
+  static void Define(napi_env env,
+                     napi_value constructor,
+                     napi_value prototype) {
+    Set(env, constructor,
+        "create", &CreateOnHeap<nu::Path>,
+        "createFromSVG", &CreateOnHeap<nu::Path, const std::string&>,
+        "createFromData", &CreateOnHeap<nu::Path, const std::vector<float>&>);
+    Set(env, prototype,
+        "moveTo", &nu::Path::MoveTo,
+        "lineTo", &nu::Path::LineTo,
+        "bezierCurveTo", &nu::Path::BezierCurveTo,
+        "quadraticCurveTo", &nu::Path::QuadraticCurveTo,
+        "arc", &nu::Path::Arc,
+        "rect", &nu::Path::Rect,
+        "closePath", &nu::Path::ClosePath,
+        "clear", &nu::Path::Clear,
+        "isEmpty", &nu::Path::IsEmpty,
+        "getBounds", &nu::Path::GetBounds,
+        "getData", &nu::Path::GetData);
+  }
 };
 
 template<>
@@ -2624,6 +2843,7 @@ struct Type<nu::TableModel> {
         "getRowCount", &nu::TableModel::GetRowCount,
         "getValue", &nu::TableModel::GetValue,
         "notifyRowInsertion", &nu::TableModel::NotifyRowInsertion,
+        "notifyRowsInsertion", &nu::TableModel::NotifyRowsInsertion,
         "notifyRowDeletion", &nu::TableModel::NotifyRowDeletion,
         "notifyValueChange", &nu::TableModel::NotifyValueChange);
   }
@@ -2662,6 +2882,83 @@ struct Type<nu::SimpleTableModel> {
   }
 };
 
+template<>
+struct Type<nu::ColumnarTableModel::Column> {
+  static constexpr const char* name = "TableColumn";
+  static napi_status FromNode(napi_env env,
+                              napi_value value,
+                              nu::ColumnarTableModel::Column* out) {
+    // Typed arrays are copied with memcpy.
+    bool is_typedarray = false;
+    napi_status s = napi_is_typedarray(env, value, &is_typedarray);
+    if (s != napi_ok)
+      return s;
+    if (is_typedarray) {
+      napi_typedarray_type type;
+      size_t length;
+      void* data;
+      s = napi_get_typedarray_info(env, value, &type, &length, &data,
+                                   nullptr, nullptr);
+      if (s != napi_ok)
+        return s;
+      if (type == napi_float64_array) {
+        auto* begin = static_cast<const double*>(data);
+        *out = nu::ColumnarTableModel::Column(
+            std::vector<double>(begin, begin + length));
+      } else if (type == napi_int32_array) {
+        auto* begin = static_cast<const int32_t*>(data);
+        *out = nu::ColumnarTableModel::Column(
+            std::vector<int32_t>(begin, begin + length));
+      } else {
+        return napi_invalid_arg;
+      }
+      return napi_ok;
+    }
+    // Arrays are decided by the type of first element.
+    uint32_t length = 0;
+    s = napi_get_array_length(env, value, &length);
+    if (s != napi_ok)
+      return s;
+    napi_valuetype type = napi_number;
+    if (length > 0) {
+      napi_value first;
+      s = napi_get_element(env, value, 0, &first);
+      if (s != napi_ok)
+        return s;
+      s = napi_typeof(env, first, &type);
+      if (s != napi_ok)
+        return s;
+    }
+    if (type == napi_string) {
+      std::vector<std::string> strings;
+      s = ConvertFromNode(env, value, &strings);
+      if (s == napi_ok)
+        *out = nu::ColumnarTableModel::Column(std::move(strings));
+    } else {
+      std::vector<double> numbers;
+      s = ConvertFromNode(env, value, &numbers);
+      if (s == napi_ok)
+        *out = nu::ColumnarTableModel::Column(std::move(numbers));
+    }
+    return s;
+  }
+};
+
+template<>
+struct Type<nu::ColumnarTableModel> {
+  using Base = nu::TableModel;
+  static constexpr const char* name = "ColumnarTableModel";
+  static void Define(napi_env env,
+                     napi_value constructor,
+                     napi_value prototype) {
+    Set(env, constructor,
+        "create", &CreateOnHeap<nu::ColumnarTableModel, uint32_t>);
+    Set(env, prototype,
+        "appendRows", &nu::ColumnarTableModel::AppendRows,
+        "setValue", &nu::ColumnarTableModel::SetValue);
+  }
+};
+
 template<>
 struct Type<nu::Table::ColumnType> {
   static constexpr const char* name = "TableColumnType";
@@ -2743,6 +3040,21 @@ struct Type<nu::Table> {
   }
 };
 
+template<>
+struct Type<nu::TextEdit::TextDelta> {
+  static constexpr const char* name = "TextDelta";
+  static napi_status ToNode(napi_env env,
+                            const nu::TextEdit::TextDelta& delta,
+                            napi_value* result) {
+    *result = CreateObject(env);
+    Set(env, *result,
+        "offset", delta.offset,
+        "deletedLength", delta.deleted_length,
+        "insertedText", delta.inserted_text);
+    return napi_ok;
+  }
+};
+
 template<>
 struct Type<nu::TextEdit> {
   using Base = nu::View;
@@ -2755,6 +3067,9 @@ struct Type<nu::TextEdit> {
     Set(env, prototype,
         "setText", &nu::TextEdit::SetText,
         "getText", &nu::TextEdit::GetText,
+        "loadBuffer", &nu::TextEdit::LoadBuffer,
+        "loadFile", &nu::TextEdit::LoadFile,
+        "isLoading", &nu::TextEdit::IsLoading,
         "redo", &nu::TextEdit::Redo,
         "canRedo", &nu::TextEdit::CanRedo,
         "undo", &nu::TextEdit::Undo,
@@ -2766,6 +3081,7 @@ struct Type<nu::TextEdit> {
         "getSelectionRange", &nu::TextEdit::GetSelectionRange,
         "selectRange", &nu::TextEdit::SelectRange,
         "getTextInRange", &nu::TextEdit::GetTextInRange,
+        "getTextLength", &nu::TextEdit::GetTextLength,
         "insertText", &nu::TextEdit::InsertText,
         "insertTextAt", &nu::TextEdit::InsertTextAt,
         "delete", &nu::TextEdit::Delete,
@@ -2782,6 +3098,7 @@ struct Type<nu::TextEdit> {
     DefineProperties(
         env, prototype,
         Signal("onTextChange", &nu::TextEdit::on_text_change),
+        Signal("onTextDelta", &nu::TextEdit::on_text_delta),
         Delegate("shouldInsertNewLine", &nu::TextEdit::should_insert_new_line));
   }
 };
@@ -3040,6 +3357,77 @@ struct Type<nu::Vibrant> {
 };
 #endif
 
+// Read the styles object and pass each property to |callback|.
+//
+// Property names are read into a stack buffer and resolved to IDs, so
+// styling views does not allocate strings for names and numbers. Names that
+// do not fit in the buffer are read as strings.
+template<typename T>
+napi_status ReadStyles(napi_env env, napi_value styles, const T& callback) {
+  if (!IsType(env, styles, napi_object))
+    return napi_object_expected;
+  napi_value keys;
+  uint32_t length;
+  napi_status s = napi_get_property_names(env, styles, &keys);
+  if (s != napi_ok)
+    return s;
+  s = napi_get_array_length(env, keys, &length);
+  if (s != napi_ok)
+    return s;
+  char name[64];
+  std::string value;
+  for (uint32_t i = 0; i < length; ++i) {
+    napi_value key, item;
+    size_t size;
+    if (napi_get_element(env, keys, i, &key) != napi_ok ||
+        napi_get_value_string_utf8(env, key, name, sizeof(name),
+                                   &size) != napi_ok ||
+        napi_get_property(env, styles, key, &item) != napi_ok)
+      continue;
+    nu::StyleProperty property;
+    if (size + 1 < sizeof(name)) {
+      property = nu::GetStyleProperty(base::StringPiece(name, size));
+    } else {
+      std::string long_name;
+      if (!FromNode(env, key, &long_name))
+        continue;
+      property = nu::GetStyleProperty(long_name);
+    }
+    float number;
+    if (FromNode(env, item, &number))
+      callback(property, number);
+    else if (FromNode(env, item, &value))
+      callback(property, value);
+  }
+  return napi_ok;
+}
+
+template<>
+struct Type<nu::StyleSheet> {
+  static constexpr const char* name = "StyleSheet";
+  static void Define(napi_env env,
+                     napi_value constructor,
+                     napi_value prototype) {
+    Set(env, constructor, "create", &Create);
+    Set(env, prototype, "getSize", &nu::StyleSheet::GetSize);
+  }
+  static nu::StyleSheet* Create(Arguments args, napi_value styles) {
+    nu::StyleSheet* sheet = new nu::StyleSheet;
+    napi_status s = ReadStyles(args.Env(), styles,
+                               [sheet](nu::StyleProperty property,
+                                       const auto& value) {
+      sheet->Set(property, value);
+    });
+    if (s != napi_ok) {
+      // Free the sheet, which is not referenced by anyone yet.
+      scoped_refptr<nu::StyleSheet> unused(sheet);
+      args.ThrowError("Object");
+      return nullptr;
+    }
+    return sheet;
+  }
+};
+
 template<>
 struct Type<nu::View> {
   using Base = nu::Responder;
@@ -3080,11 +3468,20 @@ struct Type<nu::View> {
         "setColor", &nu::View::SetColor,
         "setBackgroundColor", &nu::View::SetBackgroundColor,
         "setStyle", &SetStyle,
+        "setStyles", &nu::View::SetStyles,
         "getComputedLayout", &nu::View::GetComputedLayout,
         "getMinimumSize", &nu::View::GetMinimumSize,
+#if defined(OS_LINUX) || defined(OS_MAC)
+        "setOpacity", &nu::View::SetOpacity,
+        "getOpacity", &nu::View::GetOpacity,
+#endif
 #if defined(OS_MAC)
         "setWantsLayer", &nu::View::SetWantsLayer,
         "wantsLayer", &nu::View::WantsLayer,
+#endif
+#if defined(OS_LINUX)
+        "setCacheAsBitmap", &nu::View::SetCacheAsBitmap,
+        "isCacheAsBitmap", &nu::View::IsCacheAsBitmap,
 #endif
         "getParent", &nu::View::GetParent,
         "getWindow", &nu::View::GetWindow);
@@ -3098,18 +3495,18 @@ struct Type<nu::View> {
         Delegate("handleDragUpdate", &nu::View::handle_drag_update),
         Delegate("handleDrop", &nu::View::handle_drop));
   }
-  static void SetStyle(Arguments args,
-                       const std::map<std::string, napi_value>& styles) {
+  static void SetStyle(Arguments args, napi_value styles) {
     nu::View* view;
     if (!args.GetThis(&view))
       return;
-    for (const auto& it : styles) {
-      float number;
-      if (FromNode(args.Env(), it.second, &number))
-        view->SetStyleProperty(it.first, number);
-      else
-        view->SetStyleProperty(it.first,
-                               FromNodeTo<std::string>(args.Env(), it.second));
+    napi_status s = ReadStyles(args.Env(), styles,
+                               [view](nu::StyleProperty property,
+                                      const auto& value) {
+      view->SetStyleProperty(property, value);
+    });
+    if (s != napi_ok) {
+      args.ThrowError("Object");
+      return;
     }
     view->Layout();
   }
@@ -3295,6 +3692,7 @@ napi_value Initialize(napi_env env, napi_value exports) {
 
   ki::Set(env, exports,
           // Classes.
+          "Animation",          ki::Class<nu::Animation>(),
           "App",                ki::Class<nu::App>(),
           "Appearance",         ki::Class<nu::Appearance>(),
           "AttributedText",     ki::Class<nu::AttributedText>(),
@@ -3327,6 +3725,7 @@ napi_value Initialize(napi_env env, napi_value exports) {
           "Notification",       ki::Class<nu::Notification>(),
           "NotificationCenter", ki::Class<nu::NotificationCenter>(),
           "Painter",            ki::Class<nu::Painter>(),
+          "Path",               ki::Class<nu::Path>(),
           "Picker",             ki::Class<nu::Picker>(),
           "ProgressBar",        ki::Class<nu::ProgressBar>(),
           "ProtocolAsarJob",    ki::Class<nu::ProtocolAsarJob>(),
@@ -3337,10 +3736,12 @@ napi_value Initialize(napi_env env, napi_value exports) {
           "Scroll",             ki::Class<nu::Scroll>(),
           "Separator",          ki::Class<nu::Separator>(),
           "Slider",             ki::Class<nu::Slider>(),
+          "StyleSheet",         ki::Class<nu::StyleSheet>(),
           "Tab",                ki::Class<nu::Tab>(),
           "TableModel",         ki::Class<nu::TableModel>(),
           "AbstractTableModel", ki::Class<nu::AbstractTableModel>(),
           "SimpleTableModel",   ki::Class<nu::SimpleTableModel>(),
+          "ColumnarTableModel", ki::Class<nu::ColumnarTableModel>(),
           "Table",              ki::Class<nu::Table>(),
           "TextEdit",           ki::Class<nu::TextEdit>(),
 #if defined(OS_MAC)
@@ -0,0 +1,14 @@
+// Timing of the bindings, which is not part of the regular tests:
+//   node napi_yue/test/benchmarks.js out/Release
+
+const path = require('path')
+const fs = require('fs')
+const {assert} = require('../../third_party/bundled_node_modules/chai')
+
+const modulePath = path.resolve(__dirname, '..', '..', process.argv[2], 'gui.node')
+const gui = require(modulePath)
+
+for (const f of fs.readdirSync(__dirname)) {
+  if (f.endsWith('_benchmarks.js'))
+    require(path.join(__dirname, f)).runBenchmarks(gui, assert)
+}
@@ -0,0 +1,33 @@
+function elapsed(start) {
+  return (Number(process.hrtime.bigint() - start) / 1e6).toFixed(1)
+}
+
+exports.runBenchmarks = (gui, assert) => {
+  const rows = []
+  for (let i = 0; i < 100000; ++i)
+    rows.push({id: i, name: `row${i}`, value: i / 3})
+  const large = gui.SimpleTableModel.create(1)
+  let start = process.hrtime.bigint()
+  large.addRow([rows])
+  const toValue = elapsed(start)
+  start = process.hrtime.bigint()
+  const result = large.getValue(0, 0)
+  const toNode = elapsed(start)
+  assert.equal(result.length, rows.length)
+  console.log(`JS -> base::Value: ${toValue}ms, base::Value -> JS: ${toNode}ms`)
+
+  const columnar = gui.ColumnarTableModel.create(3)
+  const count = 2000000
+  const numbers = new Float64Array(count)
+  const integers = new Int32Array(count)
+  for (let i = 0; i < count; ++i) {
+    numbers[i] = i / 2
+    integers[i] = i
+  }
+  const strings = new Array(count).fill('sample')
+  start = process.hrtime.bigint()
+  columnar.appendRows([numbers, integers, strings])
+  const append = elapsed(start)
+  assert.equal(columnar.getRowCount(), count)
+  console.log(`ColumnarTableModel.appendRows ${count} rows: ${append}ms`)
+}
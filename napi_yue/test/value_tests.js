@@ -0,0 +1,30 @@
+exports.runTests = (gui, assert) => {
+  const model = gui.SimpleTableModel.create(3)
+  model.addRow([new Uint8Array([1, 2, 3]), {b: 1, a: [true, 'str']}, null])
+  const blob = model.getValue(0, 0)
+  assert.isTrue(Buffer.isBuffer(blob))
+  assert.deepEqual([...blob], [1, 2, 3])
+  assert.deepEqual(model.getValue(1, 0), {a: [true, 'str'], b: 1})
+  assert.strictEqual(model.getValue(2, 0), null)
+
+  const columnar = gui.ColumnarTableModel.create(3)
+  const count = 1000
+  const numbers = new Float64Array(count)
+  const integers = new Int32Array(count)
+  for (let i = 0; i < count; ++i) {
+    numbers[i] = i / 2
+    integers[i] = i
+  }
+  columnar.appendRows([numbers, integers, new Array(count).fill('sample')])
+  assert.equal(columnar.getRowCount(), count)
+  assert.strictEqual(columnar.getValue(0, 3), 1.5)
+  assert.strictEqual(columnar.getValue(1, count - 1), count - 1)
+  assert.strictEqual(columnar.getValue(2, 0), 'sample')
+
+  const sheet = gui.StyleSheet.create({width: 10, color: '#FFF'})
+  assert.equal(sheet.getSize(), 2)
+  assert.throws(() => gui.StyleSheet.create('x'))
+  const label = gui.Label.create('')
+  label.setStyle({width: 10})
+  assert.throws(() => label.setStyle(123))
+}
@@ -0,0 +1,239 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/animation.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "nativeui/animation_timeline.h"
+#include "nativeui/container.h"
+#include "nativeui/state.h"
+
+namespace nu {
+
+namespace {
+
+// Control points of the easing curves, indexed by Animation::Easing.
+const float kEasingCurves[][4] = {
+  {0.f, 0.f, 1.f, 1.f},
+  {0.25f, 0.1f, 0.25f, 1.f},
+  {0.42f, 0.f, 1.f, 1.f},
+  {0.f, 0.f, 0.58f, 1.f},
+  {0.42f, 0.f, 0.58f, 1.f},
+};
+
+// Value of the 1D cubic Bezier curve from 0 to 1 with control points |p1| and
+// |p2|, and its derivative.
+inline float BezierValue(float p1, float p2, float t) {
+  return (((1 + 3 * p1 - 3 * p2) * t + (3 * p2 - 6 * p1)) * t + 3 * p1) * t;
+}
+
+inline float BezierSlope(float p1, float p2, float t) {
+  return (3 * (1 + 3 * p1 - 3 * p2) * t + 2 * (3 * p2 - 6 * p1)) * t + 3 * p1;
+}
+
+// Return the eased progress at |x| of the timing function.
+float Ease(Animation::Easing easing, float x) {
+  if (easing == Animation::Easing::Linear || x <= 0 || x >= 1)
+    return x;
+  const float* curve = kEasingCurves[static_cast<int>(easing)];
+  // Find the t for |x| with Newton's method, which converges in a few steps
+  // for the standard curves, and fall back to bisection.
+  float t = x;
+  for (int i = 0; i < 8; ++i) {
+    float error = BezierValue(curve[0], curve[2], t) - x;
+    if (fabsf(error) < 1e-6f)
+      return BezierValue(curve[1], curve[3], t);
+    float slope = BezierSlope(curve[0], curve[2], t);
+    if (fabsf(slope) < 1e-6f)
+      break;
+    t -= error / slope;
+  }
+  float low = 0, high = 1;
+  t = x;
+  for (int i = 0; i < 32; ++i) {
+    float value = BezierValue(curve[0], curve[2], t);
+    if (fabsf(value - x) < 1e-6f)
+      break;
+    if (value < x)
+      low = t;
+    else
+      high = t;
+    t = (low + high) / 2;
+  }
+  return BezierValue(curve[1], curve[3], t);
+}
+
+inline unsigned ToChannel(float value) {
+  return static_cast<unsigned>(std::min(std::max(lroundf(value), 0L), 255L));
+}
+
+inline Color ToColor(const float* argb) {
+  return Color(ToChannel(argb[0]), ToChannel(argb[1]), ToChannel(argb[2]),
+               ToChannel(argb[3]));
+}
+
+// Return the container that View::Layout would update.
+Container* GetLayoutContainer(View* view) {
+  if (view->IsContainer())
+    return static_cast<Container*>(view);
+  View* parent = view->GetParent();
+  if (parent && parent->IsContainer())
+    return static_cast<Container*>(parent);
+  return nullptr;
+}
+
+}  // namespace
+
+Animation::Animation(int duration)
+    : duration_(base::Milliseconds(std::max(duration, 0))) {}
+
+Animation::~Animation() {}
+
+void Animation::SetDuration(int ms) {
+  duration_ = base::Milliseconds(std::max(ms, 0));
+}
+
+int Animation::GetDuration() const {
+  return static_cast<int>(duration_.InMilliseconds());
+}
+
+void Animation::SetDelay(int ms) {
+  delay_ = base::Milliseconds(std::max(ms, 0));
+}
+
+int Animation::GetDelay() const {
+  return static_cast<int>(delay_.InMilliseconds());
+}
+
+void Animation::SetEasing(Easing easing) {
+  easing_ = easing;
+}
+
+void Animation::AnimateBounds(View* view, const RectF& from, const RectF& to) {
+  AddTrack(view, Property::Bounds, StyleProperty::Invalid,
+           {from.x(), from.y(), from.width(), from.height()},
+           {to.x(), to.y(), to.width(), to.height()});
+}
+
+void Animation::AnimateColor(View* view, Color from, Color to) {
+  AddColorTrack(view, Property::Color, from, to);
+}
+
+void Animation::AnimateBackgroundColor(View* view, Color from, Color to) {
+  AddColorTrack(view, Property::BackgroundColor, from, to);
+}
+
+void Animation::AnimateStyle(View* view,
+                             StyleProperty property,
+                             float from,
+                             float to) {
+  // Colors can only be animated with AnimateColor.
+  if (property == StyleProperty::Invalid ||
+      property == StyleProperty::Color ||
+      property == StyleProperty::BackgroundColor)
+    return;
+  AddTrack(view, Property::Style, property, {from}, {to});
+}
+
+void Animation::AnimateStyle(View* view,
+                             const std::string& name,
+                             float from,
+                             float to) {
+  AnimateStyle(view, GetStyleProperty(name), from, to);
+}
+
+#if defined(OS_LINUX) || defined(OS_MAC)
+void Animation::AnimateOpacity(View* view, float from, float to) {
+  AddTrack(view, Property::Opacity, StyleProperty::Invalid, {from}, {to});
+}
+#endif
+
+void Animation::Clear() {
+  tracks_.clear();
+}
+
+void Animation::Start() {
+  start_time_ = base::TimeTicks::Now();
+  State::GetCurrent()->GetAnimationTimeline()->Add(this);
+}
+
+void Animation::Stop() {
+  State::GetCurrent()->GetAnimationTimeline()->Remove(this);
+}
+
+bool Animation::IsRunning() const {
+  return State::GetCurrent()->GetAnimationTimeline()->Contains(this);
+}
+
+bool Animation::Step(base::TimeTicks now, AnimationFrame* frame) {
+  base::TimeDelta elapsed = now - start_time_ - delay_;
+  if (elapsed.is_negative())
+    return false;
+  float t = elapsed >= duration_ ?
+      1.f : elapsed.InMillisecondsF() / duration_.InMillisecondsF();
+  float progress = Ease(easing_, t);
+  for (const Track& track : tracks_) {
+    float value[4];
+    for (int i = 0; i < 4; ++i)
+      value[i] = track.from[i] + (track.to[i] - track.from[i]) * progress;
+    View* view = track.view.get();
+    switch (track.property) {
+      case Property::Bounds:
+        frame->bounds.emplace_back(
+            view, RectF(value[0], value[1], value[2], value[3]));
+        break;
+      case Property::Color:
+        view->SetColor(ToColor(value));
+        break;
+      case Property::BackgroundColor:
+        view->SetBackgroundColor(ToColor(value));
+        break;
+      case Property::Opacity:
+#if defined(OS_LINUX) || defined(OS_MAC)
+        view->SetOpacity(value[0]);
+#endif
+        break;
+      case Property::Style: {
+        view->SetStyleProperty(track.style, value[0]);
+        Container* container = GetLayoutContainer(view);
+        if (container &&
+            std::find(frame->layouts.begin(), frame->layouts.end(),
+                      container) == frame->layouts.end())
+          frame->layouts.push_back(container);
+        break;
+      }
+    }
+  }
+  return t >= 1;
+}
+
+void Animation::AddTrack(View* view,
+                         Property property,
+                         StyleProperty style,
+                         std::initializer_list<float> from,
+                         std::initializer_list<float> to) {
+  if (!view)
+    return;
+  Track track = {view, property, style};
+  std::copy(from.begin(), from.end(), track.from);
+  std::copy(to.begin(), to.end(), track.to);
+  tracks_.push_back(std::move(track));
+}
+
+void Animation::AddColorTrack(View* view,
+                              Property property,
+                              Color from,
+                              Color to) {
+  AddTrack(view, property, StyleProperty::Invalid,
+           {static_cast<float>(from.a()), static_cast<float>(from.r()),
+            static_cast<float>(from.g()), static_cast<float>(from.b())},
+           {static_cast<float>(to.a()), static_cast<float>(to.r()),
+            static_cast<float>(to.g()), static_cast<float>(to.b())});
+}
+
+}  // namespace nu
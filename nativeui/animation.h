@@ -0,0 +1,126 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_ANIMATION_H_
+#define NATIVEUI_ANIMATION_H_
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "base/time/time.h"
+#include "nativeui/gfx/color.h"
+#include "nativeui/gfx/geometry/rect_f.h"
+#include "nativeui/signal.h"
+#include "nativeui/style_property.h"
+
+namespace nu {
+
+class View;
+struct AnimationFrame;
+
+// Interpolate properties of views over time.
+//
+// All running animations share one timeline in State, the properties are
+// computed natively on each frame and the layout is only updated once per
+// frame no matter how many views are animated.
+class NATIVEUI_EXPORT Animation : public base::RefCounted<Animation> {
+ public:
+  // Easing curves, which have the same definitions with the ones of CSS.
+  enum class Easing {
+    Linear,
+    Ease,
+    EaseIn,
+    EaseOut,
+    EaseInOut,
+  };
+
+  // The |duration| is in milliseconds.
+  explicit Animation(int duration);
+
+  void SetDuration(int ms);
+  int GetDuration() const;
+  void SetDelay(int ms);
+  int GetDelay() const;
+  void SetEasing(Easing easing);
+  Easing GetEasing() const { return easing_; }
+
+  // Add properties to animate, the values are first set when the animation
+  // has started and the delay has passed.
+  //
+  // Bounds are set after the layout of each frame, so they are only kept for
+  // views whose bounds are not changed by layout later.
+  void AnimateBounds(View* view, const RectF& from, const RectF& to);
+  void AnimateColor(View* view, Color from, Color to);
+  void AnimateBackgroundColor(View* view, Color from, Color to);
+  void AnimateStyle(View* view, StyleProperty property, float from, float to);
+  void AnimateStyle(View* view, const std::string& name, float from, float to);
+#if defined(OS_LINUX) || defined(OS_MAC)
+  void AnimateOpacity(View* view, float from, float to);
+#endif
+
+  // Remove all animated properties.
+  void Clear();
+
+  // Start or restart the animation from beginning.
+  void Start();
+
+  // Stop the animation, the properties are kept at current values and
+  // on_finish is not emitted.
+  void Stop();
+
+  bool IsRunning() const;
+
+  // Internal: Return when the animation was started.
+  base::TimeTicks GetStartTime() const { return start_time_; }
+
+  // Internal: Set the properties at |now| to |frame|, return true when the
+  // animation has finished.
+  bool Step(base::TimeTicks now, AnimationFrame* frame);
+
+  // Events.
+  Signal<void(Animation*)> on_finish;
+
+ protected:
+  virtual ~Animation();
+
+ private:
+  friend class base::RefCounted<Animation>;
+
+  enum class Property {
+    Bounds,
+    Color,
+    BackgroundColor,
+    Opacity,
+    Style,
+  };
+
+  // Colors and rects are interpolated as 4 floats, other values only use the
+  // first one.
+  struct Track {
+    scoped_refptr<View> view;
+    Property property;
+    StyleProperty style;
+    float from[4];
+    float to[4];
+  };
+
+  void AddTrack(View* view,
+                Property property,
+                StyleProperty style,
+                std::initializer_list<float> from,
+                std::initializer_list<float> to);
+  void AddColorTrack(View* view, Property property, Color from, Color to);
+
+  base::TimeDelta duration_;
+  base::TimeDelta delay_;
+  Easing easing_ = Easing::Ease;
+  base::TimeTicks start_time_;
+  std::vector<Track> tracks_;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_ANIMATION_H_
@@ -0,0 +1,86 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/animation_timeline.h"
+
+#include <algorithm>
+
+#include "nativeui/animation.h"
+#include "nativeui/container.h"
+
+namespace nu {
+
+namespace {
+
+// Interval between frames, which matches 60Hz displays.
+const int kFrameIntervalMs = 16;
+
+}  // namespace
+
+AnimationFrame::AnimationFrame() {}
+
+AnimationFrame::~AnimationFrame() {}
+
+AnimationTimeline::AnimationTimeline() {}
+
+AnimationTimeline::~AnimationTimeline() {
+  if (timer_)
+    MessageLoop::ClearTimeout(timer_);
+}
+
+void AnimationTimeline::Add(Animation* animation) {
+  if (!Contains(animation))
+    animations_.push_back(animation);
+  if (!timer_)
+    ScheduleFrame();
+}
+
+void AnimationTimeline::Remove(Animation* animation) {
+  auto it = std::find(animations_.begin(), animations_.end(), animation);
+  if (it != animations_.end())
+    animations_.erase(it);
+  if (animations_.empty() && timer_) {
+    MessageLoop::ClearTimeout(timer_);
+    timer_ = 0;
+  }
+}
+
+bool AnimationTimeline::Contains(const Animation* animation) const {
+  return std::find(animations_.begin(), animations_.end(), animation) !=
+         animations_.end();
+}
+
+void AnimationTimeline::Tick(base::TimeTicks now) {
+  AnimationFrame frame;
+  std::vector<scoped_refptr<Animation>> finished;
+  // Changing views may emit events that stop or start animations, so iterate
+  // over a copy which also keeps the views alive.
+  std::vector<scoped_refptr<Animation>> animations = animations_;
+  for (const auto& animation : animations) {
+    if (Contains(animation.get()) && animation->Step(now, &frame))
+      finished.push_back(animation);
+  }
+  Container::LayoutContainers(frame.layouts);
+  for (const auto& it : frame.bounds)
+    it.first->SetBounds(it.second);
+  // Remove finished animations before emitting events, so they can be started
+  // again in the handlers.
+  for (const auto& animation : finished)
+    Remove(animation.get());
+  for (const auto& animation : finished)
+    animation->on_finish.Emit(animation.get());
+}
+
+void AnimationTimeline::ScheduleFrame() {
+  timer_ = MessageLoop::SetTimeout(kFrameIntervalMs, [this]() { OnFrame(); });
+}
+
+void AnimationTimeline::OnFrame() {
+  timer_ = 0;
+  Tick(base::TimeTicks::Now());
+  if (!animations_.empty() && !timer_)
+    ScheduleFrame();
+}
+
+}  // namespace nu
@@ -0,0 +1,64 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_ANIMATION_TIMELINE_H_
+#define NATIVEUI_ANIMATION_TIMELINE_H_
+
+#include <utility>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "base/time/time.h"
+#include "nativeui/gfx/geometry/rect_f.h"
+#include "nativeui/message_loop.h"
+
+namespace nu {
+
+class Animation;
+class Container;
+class View;
+
+// The changes of one frame that are applied together after all animations
+// have been stepped.
+struct AnimationFrame {
+  AnimationFrame();
+  ~AnimationFrame();
+
+  // Containers whose children's styles have changed.
+  std::vector<Container*> layouts;
+  // Bounds that are set after the layout.
+  std::vector<std::pair<View*, RectF>> bounds;
+};
+
+// Drive all running animations with one frame timer, so each frame only
+// computes the layout once.
+class AnimationTimeline {
+ public:
+  AnimationTimeline();
+  ~AnimationTimeline();
+
+  AnimationTimeline& operator=(const AnimationTimeline&) = delete;
+  AnimationTimeline(const AnimationTimeline&) = delete;
+
+  // The running animations are referenced until they finish or are removed.
+  void Add(Animation* animation);
+  void Remove(Animation* animation);
+  bool Contains(const Animation* animation) const;
+
+  size_t GetAnimationCount() const { return animations_.size(); }
+
+  // Advance all animations to |now| and apply the changes.
+  void Tick(base::TimeTicks now);
+
+ private:
+  void ScheduleFrame();
+  void OnFrame();
+
+  std::vector<scoped_refptr<Animation>> animations_;
+  MessageLoop::TimerId timer_ = 0;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_ANIMATION_TIMELINE_H_
@@ -0,0 +1,218 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <vector>
+
+#include "nativeui/animation_timeline.h"
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class CountingContainer : public nu::Container {
+ public:
+  CountingContainer() {}
+
+  void UpdateChildBounds() override {
+    nu::Container::UpdateChildBounds();
+    ++layout_count_;
+  }
+
+  int layout_count() const { return layout_count_; }
+
+ private:
+  ~CountingContainer() override {}
+
+  int layout_count_ = 0;
+};
+
+class ColorContainer : public nu::Container {
+ public:
+  ColorContainer() {}
+
+  void SetColor(nu::Color color) override {
+    nu::Container::SetColor(color);
+    color_ = color;
+  }
+
+  void SetBackgroundColor(nu::Color color) override {
+    nu::Container::SetBackgroundColor(color);
+    background_color_ = color;
+  }
+
+  nu::Color color() const { return color_; }
+  nu::Color background_color() const { return background_color_; }
+
+ private:
+  ~ColorContainer() override {}
+
+  nu::Color color_;
+  nu::Color background_color_;
+};
+
+class AnimationTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    window_ = new nu::Window(nu::Window::Options());
+    window_->SetBounds(nu::RectF(0, 0, 400, 400));
+    container_ = new CountingContainer;
+    window_->SetContentView(container_.get());
+    timeline_ = state_.GetAnimationTimeline();
+  }
+
+  // Advance the timeline to |ms| after the animation started.
+  void Tick(nu::Animation* animation, int ms) {
+    timeline_->Tick(animation->GetStartTime() + base::Milliseconds(ms));
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  nu::AnimationTimeline* timeline_;
+  scoped_refptr<nu::Window> window_;
+  scoped_refptr<CountingContainer> container_;
+};
+
+TEST_F(AnimationTest, InterpolateStyle) {
+  scoped_refptr<nu::View> view = new nu::Label;
+  container_->AddChildView(view.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->SetEasing(nu::Animation::Easing::Linear);
+  animation->AnimateStyle(view.get(), "width", 0, 100);
+  int finished = 0;
+  animation->on_finish.Connect([&finished](nu::Animation*) { ++finished; });
+  animation->Start();
+  EXPECT_TRUE(animation->IsRunning());
+  Tick(animation.get(), 50);
+  EXPECT_EQ(view->GetBounds().width(), 50);
+  EXPECT_EQ(finished, 0);
+  Tick(animation.get(), 150);
+  EXPECT_EQ(view->GetBounds().width(), 100);
+  EXPECT_EQ(finished, 1);
+  EXPECT_FALSE(animation->IsRunning());
+  EXPECT_EQ(timeline_->GetAnimationCount(), 0u);
+}
+
+TEST_F(AnimationTest, Easing) {
+  scoped_refptr<nu::View> view = new nu::Label;
+  container_->AddChildView(view.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->AnimateStyle(view.get(), nu::StyleProperty::Width, 0, 100);
+  animation->SetEasing(nu::Animation::Easing::EaseInOut);
+  animation->Start();
+  Tick(animation.get(), 50);
+  EXPECT_NEAR(view->GetBounds().width(), 50, 1);
+  Tick(animation.get(), 25);
+  EXPECT_LT(view->GetBounds().width(), 25);
+  animation->SetEasing(nu::Animation::Easing::EaseOut);
+  Tick(animation.get(), 25);
+  EXPECT_GT(view->GetBounds().width(), 25);
+}
+
+TEST_F(AnimationTest, Delay) {
+  scoped_refptr<nu::View> view = new nu::Label;
+  view->SetStyle("width", 10);
+  container_->AddChildView(view.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->SetDelay(100);
+  animation->SetEasing(nu::Animation::Easing::Linear);
+  animation->AnimateStyle(view.get(), "width", 0, 100);
+  animation->Start();
+  Tick(animation.get(), 50);
+  EXPECT_EQ(view->GetBounds().width(), 10);
+  Tick(animation.get(), 150);
+  EXPECT_EQ(view->GetBounds().width(), 50);
+}
+
+TEST_F(AnimationTest, StopAndRestart) {
+  scoped_refptr<nu::View> view = new nu::Label;
+  container_->AddChildView(view.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->SetEasing(nu::Animation::Easing::Linear);
+  animation->AnimateStyle(view.get(), "width", 0, 100);
+  int finished = 0;
+  animation->on_finish.Connect([&finished](nu::Animation* animation) {
+    // Finished animations can be started again.
+    if (++finished == 1)
+      animation->Start();
+  });
+  animation->Start();
+  Tick(animation.get(), 200);
+  EXPECT_EQ(finished, 1);
+  EXPECT_TRUE(animation->IsRunning());
+  // Stopped animations keep current values without emitting on_finish.
+  Tick(animation.get(), 20);
+  animation->Stop();
+  EXPECT_FALSE(animation->IsRunning());
+  timeline_->Tick(animation->GetStartTime() + base::Milliseconds(200));
+  EXPECT_EQ(view->GetBounds().width(), 20);
+  EXPECT_EQ(finished, 1);
+}
+
+TEST_F(AnimationTest, BoundsAfterLayout) {
+  scoped_refptr<nu::View> view = new nu::Label;
+  container_->AddChildView(view.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->SetEasing(nu::Animation::Easing::Linear);
+  animation->AnimateBounds(view.get(), nu::RectF(0, 0, 10, 10),
+                           nu::RectF(100, 100, 30, 30));
+  animation->AnimateStyle(view.get(), "height", 0, 100);
+  animation->Start();
+  Tick(animation.get(), 50);
+  EXPECT_EQ(view->GetBounds(), nu::RectF(50, 50, 20, 20));
+}
+
+TEST_F(AnimationTest, LayoutOncePerFrame) {
+  const int kViewCount = 100;
+  scoped_refptr<nu::Container> inner = new nu::Container;
+  container_->AddChildView(inner.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->SetEasing(nu::Animation::Easing::Linear);
+  std::vector<scoped_refptr<nu::View>> views;
+  for (int i = 0; i < kViewCount; ++i) {
+    views.push_back(new nu::Label);
+    // Half of the views are in a nested container.
+    if (i % 2)
+      container_->AddChildView(views.back().get());
+    else
+      inner->AddChildView(views.back().get());
+    animation->AnimateStyle(views.back().get(), "height", 0, 2);
+  }
+  animation->Start();
+  int count = container_->layout_count();
+  Tick(animation.get(), 50);
+  EXPECT_EQ(container_->layout_count(), count + 1);
+  EXPECT_EQ(views[0]->GetBounds().height(), 1);
+  EXPECT_EQ(views[1]->GetBounds().height(), 1);
+  EXPECT_EQ(inner->GetBounds().height(), kViewCount / 2);
+}
+
+#if defined(OS_LINUX) || defined(OS_MAC)
+TEST_F(AnimationTest, Opacity) {
+  scoped_refptr<nu::View> view = new nu::Label;
+  container_->AddChildView(view.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->SetEasing(nu::Animation::Easing::Linear);
+  animation->AnimateOpacity(view.get(), 0, 1);
+  animation->Start();
+  Tick(animation.get(), 50);
+  EXPECT_NEAR(view->GetOpacity(), 0.5, 0.01);
+}
+#endif
+
+TEST_F(AnimationTest, InterpolateColors) {
+  scoped_refptr<ColorContainer> view = new ColorContainer;
+  container_->AddChildView(view.get());
+  scoped_refptr<nu::Animation> animation = new nu::Animation(100);
+  animation->SetEasing(nu::Animation::Easing::Linear);
+  animation->AnimateColor(view.get(), nu::Color(255, 0, 0),
+                          nu::Color(0, 0, 255));
+  animation->AnimateBackgroundColor(view.get(), nu::Color(0, 0, 0, 0),
+                                    nu::Color(255, 10, 255, 20));
+  animation->Start();
+  // Channels are rounded to the nearest integer.
+  Tick(animation.get(), 50);
+  EXPECT_EQ(view->color(), nu::Color(255, 128, 0, 128));
+  EXPECT_EQ(view->background_color(), nu::Color(128, 5, 128, 10));
+  Tick(animation.get(), 100);
+  EXPECT_EQ(view->color(), nu::Color(0, 0, 255));
+  EXPECT_EQ(view->background_color(), nu::Color(255, 10, 255, 20));
+}
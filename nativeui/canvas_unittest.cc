@@ -0,0 +1,128 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#if defined(OS_LINUX)
+#include "nativeui/gfx/gtk/surface_pool.h"
+#endif
+
+class CanvasTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    canvas_ = new nu::Canvas(nu::SizeF(100, 100), 1.f);
+  }
+
+  uint32_t GetPixel(int x, int y) {
+    nu::Canvas::Pixels pixels = canvas_->LockPixels();
+    uint32_t pixel = *reinterpret_cast<uint32_t*>(
+        pixels.data + y * pixels.stride + x * 4);
+    canvas_->UnlockPixels();
+    return pixel;
+  }
+
+  nu::State state_;
+  scoped_refptr<nu::Canvas> canvas_;
+};
+
+TEST_F(CanvasTest, LockPixels) {
+  nu::Canvas::Pixels pixels = canvas_->LockPixels();
+  EXPECT_EQ(pixels.width, 100);
+  EXPECT_EQ(pixels.height, 100);
+  EXPECT_GE(std::abs(pixels.stride), 400);
+  canvas_->UnlockPixels();
+  EXPECT_EQ(canvas_->GetPixelSize(), nu::Size(100, 100));
+  // Pending drawing is finished.
+  canvas_->GetPainter()->SetFillColor(nu::Color(255, 0, 0));
+  canvas_->GetPainter()->FillRect(nu::RectF(0, 0, 10, 10));
+  EXPECT_EQ((GetPixel(5, 5) >> 16) & 0xFF, 0xFFu);
+  EXPECT_EQ((GetPixel(50, 50) >> 16) & 0xFF, 0u);
+}
+
+TEST_F(CanvasTest, PutImageData) {
+  std::vector<uint32_t> data(20 * 10, 0xFF00FF00);
+  nu::Buffer buffer = nu::Buffer::Wrap(data.data(), data.size() * 4);
+  EXPECT_TRUE(canvas_->PutImageData(buffer, nu::Rect(10, 20, 20, 10)));
+  EXPECT_EQ(GetPixel(10, 20), 0xFF00FF00);
+  EXPECT_EQ(GetPixel(29, 29), 0xFF00FF00);
+  EXPECT_EQ(GetPixel(30, 29), 0u);
+  nu::Buffer copy = canvas_->GetImageData(nu::Rect(10, 20, 20, 10));
+  ASSERT_EQ(copy.size(), data.size() * 4);
+  EXPECT_EQ(memcmp(copy.content(), data.data(), copy.size()), 0);
+  // Out of canvas.
+  EXPECT_FALSE(canvas_->PutImageData(buffer, nu::Rect(90, 90, 20, 10)));
+  EXPECT_EQ(canvas_->GetImageData(nu::Rect(90, 90, 20, 10)).size(), 0u);
+  // Not enough data.
+  EXPECT_FALSE(canvas_->PutImageData(buffer, nu::Rect(0, 0, 20, 20)));
+}
+
+TEST_F(CanvasTest, Resize) {
+  canvas_->GetPainter()->SetFillColor(nu::Color(255, 0, 0));
+  canvas_->GetPainter()->FillRect(nu::RectF(0, 0, 100, 100));
+  canvas_->Resize(nu::SizeF(50, 60));
+  EXPECT_EQ(canvas_->GetSize(), nu::SizeF(50, 60));
+  EXPECT_EQ(canvas_->GetPixelSize(), nu::Size(50, 60));
+  EXPECT_EQ(GetPixel(49, 59), 0u);
+  canvas_->GetPainter()->SetFillColor(nu::Color(255, 0, 0));
+  canvas_->GetPainter()->FillRect(nu::RectF(0, 0, 10, 10));
+  EXPECT_EQ((GetPixel(5, 5) >> 16) & 0xFF, 0xFFu);
+  canvas_->Resize(nu::SizeF(200, 100));
+  EXPECT_EQ(canvas_->GetPixelSize(), nu::Size(200, 100));
+  EXPECT_EQ(GetPixel(5, 5), 0u);
+  EXPECT_EQ(GetPixel(199, 99), 0u);
+}
+
+#if defined(OS_LINUX)
+TEST_F(CanvasTest, SurfacePool) {
+  nu::SurfacePool* pool = state_.GetSurfacePool();
+  pool->Clear();
+  size_t hits = pool->stats().hits;
+  size_t misses = pool->stats().misses;
+  // Memory of destroyed canvas is reused.
+  canvas_ = new nu::Canvas(nu::SizeF(100, 100), 1.f);
+  canvas_ = nullptr;
+  EXPECT_GT(pool->stats().pooled_bytes, 0u);
+  canvas_ = new nu::Canvas(nu::SizeF(100, 100), 1.f);
+  EXPECT_EQ(pool->stats().hits, hits + 1);
+  EXPECT_EQ(pool->stats().misses, misses + 1);
+  EXPECT_EQ(GetPixel(50, 50), 0u);
+  // Shrinking keeps memory.
+  size_t reuses = pool->stats().reuses;
+  canvas_->Resize(nu::SizeF(90, 90));
+  EXPECT_EQ(pool->stats().reuses, reuses + 1);
+  canvas_->Resize(nu::SizeF(20, 20));
+  EXPECT_EQ(pool->stats().reuses, reuses + 1);
+  // Memory limit.
+  canvas_ = nullptr;
+  pool->SetMemoryLimit(1024);
+  EXPECT_EQ(pool->stats().pooled_bytes, 0u);
+  canvas_ = new nu::Canvas(nu::SizeF(100, 100), 1.f);
+  canvas_ = nullptr;
+  EXPECT_EQ(pool->stats().pooled_bytes, 0u);
+}
+#endif
+
+TEST_F(CanvasTest, CreateManyCanvases) {
+  for (int i = 0; i < 16; ++i) {
+    scoped_refptr<nu::Canvas> canvas =
+        new nu::Canvas(nu::SizeF(512 + i % 8, 512), 1.f);
+    EXPECT_EQ(canvas->GetPixelSize(), nu::Size(512 + i % 8, 512));
+    canvas->GetPainter()->FillRect(nu::RectF(0, 0, 10, 10));
+  }
+}
+
+TEST_F(CanvasTest, PutImageDataWholeCanvas) {
+  std::vector<uint32_t> data(100 * 100, 0xFF336699);
+  nu::Buffer buffer = nu::Buffer::Wrap(data.data(), data.size() * 4);
+  for (int i = 0; i < 2; ++i)
+    EXPECT_TRUE(canvas_->PutImageData(buffer, nu::Rect(0, 0, 100, 100)));
+  EXPECT_EQ(GetPixel(0, 0), 0xFF336699);
+  EXPECT_EQ(GetPixel(99, 99), 0xFF336699);
+}
@@ -9,6 +9,9 @@
 #include <utility>
 
 #include "base/logging.h"
+#include "nativeui/gfx/attributed_text.h"
+#include "nativeui/gfx/display_list.h"
+#include "nativeui/label.h"
 #include "third_party/yoga/yoga/Yoga.h"
 
 namespace nu {
@@ -26,6 +29,28 @@ inline RectF GetYGNodeBounds(YGNodeRef node) {
                YGNodeLayoutGetWidth(node), YGNodeLayoutGetHeight(node));
 }
 
+#if defined(OS_LINUX)
+// Measuring texts in parallel only pays off for a large number of texts.
+const size_t kMinParallelMeasureCount = 64;
+
+// Collect the texts of Labels that have not been measured.
+void CollectUnmeasuredTexts(Container* container,
+                            std::vector<AttributedText*>* texts) {
+  for (int i = 0; i < container->ChildCount(); ++i) {
+    View* child = container->ChildAt(i);
+    if (!child->IsVisible())
+      continue;
+    if (child->IsContainer()) {
+      CollectUnmeasuredTexts(static_cast<Container*>(child), texts);
+    } else if (child->GetClassName() == Label::kClassName) {
+      AttributedText* text = static_cast<Label*>(child)->GetAttributedText();
+      if (!text->IsMeasured())
+        texts->push_back(text);
+    }
+  }
+}
+#endif
+
 }  // namespace
 
 // static
@@ -78,6 +103,10 @@ void Container::OnSizeChanged() {
 }
 #endif
 
+void Container::OnSchedulePaint() {
+  display_list_ = nullptr;
+}
+
 SizeF Container::GetPreferredSize() const {
   float nan = std::numeric_limits<float>::quiet_NaN();
   YGNodeCalculateLayout(node(), nan, nan, YGDirectionLTR);
@@ -140,12 +169,26 @@ void Container::RemoveChildView(View* view) {
   Layout();
 }
 
+void Container::SetUseDisplayList(bool use) {
+  use_display_list_ = use;
+  display_list_ = nullptr;
+}
+
 void Container::UpdateChildBounds() {
   dirty_ = false;
   if (!IsVisibleInHierarchy())
     return;
   // For root CSS node, calculate the layout before setting bounds.
   if (IsRootYGNode(this)) {
+#if defined(OS_LINUX)
+    // Measure new texts in parallel so the layout can use cached results.
+    if (YGNodeIsDirty(node())) {
+      std::vector<AttributedText*> texts;
+      CollectUnmeasuredTexts(this, &texts);
+      if (texts.size() >= kMinParallelMeasureCount)
+        AttributedText::MeasureInParallel(texts);
+    }
+#endif
     SizeF size = GetBounds().size();
     YGNodeCalculateLayout(node(), size.width(), size.height(), YGDirectionLTR);
   }
@@ -156,4 +199,47 @@ void Container::UpdateChildBounds() {
   }
 }
 
+// static
+void Container::LayoutContainers(const std::vector<Container*>& containers) {
+  // Mark the containers and their ancestors as dirty like what Layout does,
+  // while remembering them from outer to inner.
+  std::vector<Container*> roots;
+  std::vector<Container*> dirty;
+  for (Container* container : containers) {
+    size_t begin = dirty.size();
+    Container* view = container;
+    while (!IsRootYGNode(view)) {
+      view->dirty_ = true;
+      dirty.push_back(view);
+      view = static_cast<Container*>(view->GetParent());
+    }
+    std::reverse(dirty.begin() + begin, dirty.end());
+    if (std::find(roots.begin(), roots.end(), view) == roots.end())
+      roots.push_back(view);
+  }
+  for (Container* root : roots)
+    root->UpdateChildBounds();
+  // Update the containers that were not updated because their sizes did not
+  // change.
+  for (Container* container : dirty) {
+    if (container->dirty_)
+      container->UpdateChildBounds();
+  }
+}
+
+void Container::Draw(Painter* painter, const RectF& dirty) {
+  if (!use_display_list_) {
+    on_draw.Emit(this, painter, dirty);
+    return;
+  }
+  // Record the whole view, so later redraws of any part can be replayed.
+  SizeF size = GetBounds().size();
+  if (!display_list_ || display_list_->GetSize() != size) {
+    display_list_ = new DisplayList(size);
+    RecordingPainter recorder(display_list_.get());
+    on_draw.Emit(this, &recorder, RectF(size));
+  }
+  display_list_->Replay(painter, dirty);
+}
+
 }  // namespace nu
@@ -11,6 +11,7 @@
 
 namespace nu {
 
+class DisplayList;
 class Painter;
 
 class NATIVEUI_EXPORT Container : public View {
@@ -27,6 +28,7 @@ class NATIVEUI_EXPORT Container : public View {
 #if defined(OS_MAC)
   void OnSizeChanged() override;
 #endif
+  void OnSchedulePaint() override;
 
   // Gets preferred size of view.
   SizeF GetPreferredSize() const;
@@ -48,9 +50,21 @@ class NATIVEUI_EXPORT Container : public View {
     return children_[index].get();
   }
 
+  // Record the drawing in on_draw and replay it until next SchedulePaint,
+  // instead of emitting on_draw for every redraw.
+  void SetUseDisplayList(bool use);
+  bool IsUsingDisplayList() const { return use_display_list_; }
+
   // Internal: Used by certain implementations to refresh layout.
   virtual void UpdateChildBounds();
 
+  // Internal: Update the layout of |containers| as calling Layout on each of
+  // them, but the layout of each root node is only calculated once.
+  static void LayoutContainers(const std::vector<Container*>& containers);
+
+  // Internal: Draw the |dirty| rect of container's content.
+  void Draw(Painter* painter, const RectF& dirty);
+
   // Events.
   Signal<void(Container*, Painter*, RectF)> on_draw;
 
@@ -76,6 +90,10 @@ class NATIVEUI_EXPORT Container : public View {
 
   // Whether the container should update children's layout.
   bool dirty_ = false;
+
+  // The recorded on_draw, reset when the view is scheduled to repaint.
+  bool use_display_list_ = false;
+  scoped_refptr<DisplayList> display_list_;
 };
 
 }  // namespace nu
@@ -2,9 +2,15 @@
 // Use of this source code is governed by the license that can be found in the
 // LICENSE file.
 
+#include "base/files/file_path.h"
+#include "base/path_service.h"
 #include "nativeui/nativeui.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+#if defined(OS_LINUX)
+#include <gtk/gtk.h>
+#endif
+
 class TestContainer : public nu::Container {
  public:
   TestContainer() {}
@@ -174,3 +180,152 @@ TEST_F(ContainerTest, MoveBetweenContainers) {
   EXPECT_EQ(v1->GetBounds(), nu::RectF(0, 0, 200, 100));
   EXPECT_EQ(v2->GetBounds(), nu::RectF(0, 100, 200, 100));
 }
+
+TEST_F(ContainerTest, DisplayList) {
+  int draw_count = 0;
+  container_->on_draw.Connect([&](nu::Container*, nu::Painter* painter,
+                                  nu::RectF) {
+    ++draw_count;
+    painter->FillRect(nu::RectF(0, 0, 10, 10));
+  });
+  scoped_refptr<nu::Canvas> canvas = new nu::Canvas(nu::SizeF(400, 400), 1.f);
+  nu::RectF dirty(0, 0, 400, 400);
+  container_->Draw(canvas->GetPainter(), dirty);
+  container_->Draw(canvas->GetPainter(), dirty);
+  EXPECT_EQ(draw_count, 2);
+  container_->SetUseDisplayList(true);
+  container_->Draw(canvas->GetPainter(), dirty);
+  container_->Draw(canvas->GetPainter(), nu::RectF(0, 0, 5, 5));
+  EXPECT_EQ(draw_count, 3);
+  container_->SchedulePaint();
+  container_->Draw(canvas->GetPainter(), dirty);
+  EXPECT_EQ(draw_count, 4);
+  container_->SchedulePaintRect(nu::RectF(0, 0, 5, 5));
+  container_->Draw(canvas->GetPainter(), dirty);
+  EXPECT_EQ(draw_count, 5);
+}
+
+TEST_F(ContainerTest, DisplayListManyExposes) {
+  const int kExposeCount = 100;
+  int call_count = 0;
+  container_->on_draw.Connect([&](nu::Container*, nu::Painter* painter,
+                                  nu::RectF) {
+    // Simulate a handler issuing many painter calls from script.
+    for (int i = 0; i < 1000; ++i) {
+      painter->SetFillColor(nu::Color(i % 256, 0, 0));
+      painter->FillRect(nu::RectF(i % 40 * 10, i / 40 * 10, 10, 10));
+      call_count += 2;
+    }
+  });
+  scoped_refptr<nu::Canvas> canvas = new nu::Canvas(nu::SizeF(400, 400), 1.f);
+  nu::RectF dirty(0, 0, 400, 400);
+  for (int i = 0; i < kExposeCount; ++i)
+    container_->Draw(canvas->GetPainter(), dirty);
+  EXPECT_EQ(call_count, 2000 * kExposeCount);
+  // The handler only runs once when the display list is replayed.
+  call_count = 0;
+  container_->SetUseDisplayList(true);
+  for (int i = 0; i < kExposeCount; ++i)
+    container_->Draw(canvas->GetPainter(), dirty);
+  EXPECT_EQ(call_count, 2000);
+}
+
+#if defined(OS_LINUX)
+TEST_F(ContainerTest, CacheAsBitmap) {
+  window_->SetContentSize(nu::SizeF(200, 200));
+  window_->SetVisible(true);
+  scoped_refptr<nu::Container> child = new nu::Container;
+  child->SetStyle("flex", 1);
+  int draw_count = 0;
+  child->on_draw.Connect([&draw_count](nu::Container*, nu::Painter*,
+                                       nu::RectF) {
+    ++draw_count;
+  });
+  container_->AddChildView(child.get());
+  container_->SetCacheAsBitmap(true);
+  EXPECT_TRUE(container_->IsCacheAsBitmap());
+
+  cairo_surface_t* surface =
+      cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 200, 200);
+  cairo_t* context = cairo_create(surface);
+  gtk_widget_draw(container_->GetNative(), context);
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_EQ(draw_count, 1);
+  EXPECT_TRUE(container_->HasCachedBitmap());
+  // Painting children invalidates the cache.
+  child->SchedulePaint();
+  EXPECT_FALSE(container_->HasCachedBitmap());
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_EQ(draw_count, 2);
+  // So does layout.
+  child->SetStyle("flex", 0, "height", 50);
+  EXPECT_FALSE(container_->HasCachedBitmap());
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_EQ(draw_count, 3);
+  // Disabling.
+  container_->SetCacheAsBitmap(false);
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_EQ(draw_count, 4);
+  cairo_destroy(context);
+  cairo_surface_destroy(surface);
+}
+
+TEST_F(ContainerTest, CacheAsBitmapNativeWidgets) {
+  window_->SetContentSize(nu::SizeF(200, 200));
+  window_->SetVisible(true);
+  scoped_refptr<nu::Container> child = new nu::Container;
+  child->SetStyle("flex", 1);
+  int draw_count = 0;
+  child->on_draw.Connect([&draw_count](nu::Container*, nu::Painter*,
+                                       nu::RectF) {
+    ++draw_count;
+  });
+  container_->AddChildView(child.get());
+  container_->AddChildView(new nu::Label("label"));
+  base::FilePath exe_path;
+  base::PathService::Get(base::FILE_EXE, &exe_path);
+  base::FilePath gif_path = exe_path.DirName().DirName().DirName()
+                                    .Append(FILE_PATH_LITERAL("nativeui"))
+                                    .Append(FILE_PATH_LITERAL("test"))
+                                    .Append(FILE_PATH_LITERAL("fixtures"))
+                                    .Append(FILE_PATH_LITERAL("animated.gif"));
+  scoped_refptr<nu::GifPlayer> gif = new nu::GifPlayer;
+  gif->SetImage(new nu::Image(gif_path));
+  gif->SetAnimating(false);
+  container_->AddChildView(gif.get());
+  container_->SetCacheAsBitmap(true);
+
+  cairo_surface_t* surface =
+      cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 200, 200);
+  cairo_t* context = cairo_create(surface);
+  gtk_widget_draw(container_->GetNative(), context);
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_TRUE(container_->HasCachedBitmap());
+  EXPECT_EQ(draw_count, 1);
+  // Advancing the animation frame drops the cache.
+  gif->ScheduleFrame();
+  EXPECT_FALSE(container_->HasCachedBitmap());
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_TRUE(container_->HasCachedBitmap());
+  EXPECT_EQ(draw_count, 2);
+  // Adding a native widget drops the cache.
+  scoped_refptr<nu::Entry> entry = new nu::Entry;
+  child->AddChildView(entry.get());
+  EXPECT_FALSE(container_->HasCachedBitmap());
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_EQ(draw_count, 3);
+  // Changes of the native widget are always drawn.
+  entry->SetText("changed");
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_FALSE(container_->HasCachedBitmap());
+  EXPECT_EQ(draw_count, 4);
+  // The cache comes back after removing it.
+  child->RemoveChildView(entry.get());
+  gtk_widget_draw(container_->GetNative(), context);
+  gtk_widget_draw(container_->GetNative(), context);
+  EXPECT_TRUE(container_->HasCachedBitmap());
+  EXPECT_EQ(draw_count, 5);
+  cairo_destroy(context);
+  cairo_surface_destroy(surface);
+}
+#endif
@@ -0,0 +1,64 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "base/files/file_path.h"
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class FontTest : public testing::Test {
+ protected:
+  nu::State state_;
+};
+
+TEST_F(FontTest, Interned) {
+  scoped_refptr<nu::Font> f1 = nu::Font::Get("Arial", 12,
+                                             nu::Font::Weight::Normal,
+                                             nu::Font::Style::Normal);
+  scoped_refptr<nu::Font> f2 = nu::Font::Get("Arial", 12,
+                                             nu::Font::Weight::Normal,
+                                             nu::Font::Style::Normal);
+  EXPECT_EQ(f1, f2);
+  scoped_refptr<nu::Font> f3 = nu::Font::Get("Arial", 12,
+                                             nu::Font::Weight::Bold,
+                                             nu::Font::Style::Normal);
+  EXPECT_NE(f1, f3);
+  EXPECT_EQ(f1->Derive(0, nu::Font::Weight::Bold, nu::Font::Style::Normal),
+            f3);
+  EXPECT_EQ(state_.fonts().size(), 2u);
+}
+
+TEST_F(FontTest, ReleasedFontRemoved) {
+  scoped_refptr<nu::Font> font = nu::Font::Get("Arial", 12,
+                                               nu::Font::Weight::Normal,
+                                               nu::Font::Style::Normal);
+  EXPECT_EQ(state_.fonts().size(), 1u);
+  font = nullptr;
+  EXPECT_TRUE(state_.fonts().empty());
+}
+
+TEST_F(FontTest, GetFromInvalidPath) {
+  base::FilePath path(FILE_PATH_LITERAL("/not/exist/font.ttf"));
+  scoped_refptr<nu::Font> f1 = nu::Font::GetFromPath(path, 12);
+  scoped_refptr<nu::Font> f2 = nu::Font::GetFromPath(path, 12);
+  EXPECT_EQ(f1, f2);
+  EXPECT_EQ(f1->GetSize(), 12);
+}
+
+TEST(FontStateTest, FontOutlivesState) {
+  scoped_refptr<nu::Font> old_font;
+  {
+    nu::State state;
+    old_font = nu::Font::Get("Arial", 12, nu::Font::Weight::Normal,
+                             nu::Font::Style::Normal);
+  }
+  nu::State state;
+  scoped_refptr<nu::Font> font = nu::Font::Get("Arial", 12,
+                                               nu::Font::Weight::Normal,
+                                               nu::Font::Style::Normal);
+  EXPECT_NE(font, old_font);
+  // Releasing the old font does not remove the new one with the same key.
+  old_font = nullptr;
+  ASSERT_EQ(state.fonts().size(), 1u);
+  EXPECT_EQ(state.fonts().begin()->second, font.get());
+}
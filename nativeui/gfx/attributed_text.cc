@@ -6,10 +6,10 @@
 
 #include <float.h>  // needed for FLT_MAX on arm64 macOS
 
+#include <cmath>
 #include <utility>
 
 #include "nativeui/gfx/font.h"
-#include "nativeui/gfx/geometry/rect_f.h"
 
 namespace nu {
 
@@ -19,6 +19,16 @@ inline bool RangeInvalid(int start, int end) {
   return start < 0 || (end >= 0 && end <= start);
 }
 
+// Yoga uses NaN for undefined size, which should match itself.
+inline bool SizeComponentEquals(float a, float b) {
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+// Whether the size limit |a| is not smaller than the length |b|.
+inline bool SizeComponentFits(float a, float b) {
+  return std::isnan(a) || a >= b;
+}
+
 }  // namespace
 
 // The system does not specify default system font and color for AttributedText
@@ -29,6 +39,7 @@ AttributedText::AttributedText(const std::string& text, TextFormat format)
 void AttributedText::SetFormat(TextFormat format) {
   format_ = std::move(format);
   PlatformUpdateFormat();
+  InvalidateMeasureCache();
 }
 
 void AttributedText::SetFont(scoped_refptr<Font> font) {
@@ -39,6 +50,7 @@ void AttributedText::SetFontFor(scoped_refptr<Font> font, int start, int end) {
   if (RangeInvalid(start, end))
     return;
   PlatformSetFontFor(std::move(font), start, end);
+  InvalidateMeasureCache();
 }
 
 void AttributedText::SetColor(Color color) {
@@ -49,6 +61,7 @@ void AttributedText::SetColorFor(Color color, int start, int end) {
   if (RangeInvalid(start, end))
     return;
   PlatformSetColorFor(color, start, end);
+  InvalidateMeasureCache();
 }
 
 void AttributedText::Clear() {
@@ -57,6 +70,34 @@ void AttributedText::Clear() {
   SetColor(attrs.color);
 }
 
+RectF AttributedText::GetBoundsFor(const SizeF& size) const {
+  for (size_t i = 0; i < measure_cache_count_; ++i) {
+    const MeasureCacheEntry& entry = measure_cache_[i];
+    if (SizeComponentEquals(entry.size.width(), size.width()) &&
+        SizeComponentEquals(entry.size.height(), size.height()))
+      return entry.bounds;
+  }
+  if (natural_bounds_ &&
+      SizeComponentFits(size.width(), natural_bounds_->width()) &&
+      SizeComponentFits(size.height(), natural_bounds_->height()))
+    return *natural_bounds_;
+  RectF bounds = PlatformGetBoundsFor(size);
+  ++measure_count_;
+  if (std::isnan(size.width()) && std::isnan(size.height()))
+    natural_bounds_ = bounds;
+  // Replace the oldest entry when cache is full.
+  measure_cache_[measure_cache_next_] = {size, bounds};
+  measure_cache_next_ = (measure_cache_next_ + 1) % kMeasureCacheSize;
+  if (measure_cache_count_ < kMeasureCacheSize)
+    ++measure_cache_count_;
+  return bounds;
+}
+
+void AttributedText::SetText(const std::string& text) {
+  PlatformSetText(text);
+  InvalidateMeasureCache();
+}
+
 SizeF AttributedText::GetOneLineSize() const {
   return GetBoundsFor(SizeF(FLT_MAX, FLT_MAX)).size();
 }
@@ -65,4 +106,10 @@ float AttributedText::GetOneLineHeight() const {
   return GetOneLineSize().height();
 }
 
+void AttributedText::InvalidateMeasureCache() {
+  measure_cache_count_ = 0;
+  measure_cache_next_ = 0;
+  natural_bounds_.reset();
+}
+
 }  // namespace nu
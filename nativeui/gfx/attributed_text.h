@@ -5,10 +5,13 @@
 #ifndef NATIVEUI_GFX_ATTRIBUTED_TEXT_H_
 #define NATIVEUI_GFX_ATTRIBUTED_TEXT_H_
 
+#include <array>
 #include <string>
+#include <vector>
 
 #include "base/memory/ref_counted.h"
 #include "nativeui/gfx/color.h"
+#include "nativeui/gfx/geometry/rect_f.h"
 #include "nativeui/gfx/text.h"
 #include "nativeui/types.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -16,8 +19,6 @@
 namespace nu {
 
 class Font;
-class RectF;
-class SizeF;
 
 class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
  public:
@@ -45,6 +46,26 @@ class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
   SizeF GetOneLineSize() const;
   float GetOneLineHeight() const;
 
+  // Private: How many times the text has been measured by system APIs.
+  int GetMeasureCount() const { return measure_count_; }
+
+  // Private: Whether there are measure results that can be reused.
+  bool IsMeasured() const {
+    return measure_cache_count_ > 0 || natural_bounds_.has_value();
+  }
+
+#if defined(OS_LINUX)
+  // Private: Measure the texts without size limits on background threads,
+  // the results are put into the measure cache so following layout can reuse
+  // them.
+  static void MeasureInParallel(const std::vector<AttributedText*>& texts);
+
+  // Private: Set the size of PangoLayout before drawing, since the bounds
+  // may come from cache and the layout could have been used for measuring
+  // other sizes.
+  void SetLayoutSize(const SizeF& size) const;
+#endif
+
   NativeAttributedText GetNative() const { return text_; }
 
  protected:
@@ -56,6 +77,18 @@ class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
   void PlatformUpdateFormat();
   void PlatformSetFontFor(scoped_refptr<Font> font, int start, int end);
   void PlatformSetColorFor(Color color, int start, int end);
+  void PlatformSetText(const std::string& text);
+  RectF PlatformGetBoundsFor(const SizeF& size) const;
+
+  // Layout engines usually measure the same text with a few different sizes
+  // repeatedly, keep the recent results since measuring text is expensive.
+  struct MeasureCacheEntry {
+    SizeF size;
+    RectF bounds;
+  };
+  static constexpr size_t kMeasureCacheSize = 8;
+
+  void InvalidateMeasureCache();
 
 #if defined(OS_MAC)
   // On macOS the attributes added must have range specified, so it is
@@ -67,6 +100,14 @@ class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
 
   NativeAttributedText text_;
   TextFormat format_;
+
+  mutable std::array<MeasureCacheEntry, kMeasureCacheSize> measure_cache_;
+  mutable size_t measure_cache_count_ = 0;
+  mutable size_t measure_cache_next_ = 0;
+  mutable int measure_count_ = 0;
+  // The bounds of text without size limits, which are also the result of any
+  // size that is not smaller.
+  mutable absl::optional<RectF> natural_bounds_;
 };
 
 }  // namespace nu
@@ -4,6 +4,11 @@
 
 #include "nativeui/gfx/canvas.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+#include "base/logging.h"
+#include "nativeui/buffer.h"
 #include "nativeui/gfx/painter.h"
 #include "nativeui/screen.h"
 
@@ -21,7 +26,68 @@ Canvas::Canvas(const SizeF& size, float scale_factor)
 }
 
 Canvas::~Canvas() {
+  DCHECK(!pixels_locked_);
   PlatformDestroyBitmap(bitmap_);
 }
 
+void Canvas::Resize(const SizeF& size) {
+  DCHECK(!pixels_locked_);
+  SizeF new_size = size.IsEmpty() ? SizeF(1, 1) : size;
+  if (new_size == size_)
+    return;
+  size_ = new_size;
+  // The painter may reference the bitmap.
+  painter_.reset();
+  bitmap_ = PlatformResizeBitmap(bitmap_, size_, scale_factor_);
+  painter_.reset(PlatformCreatePainter(bitmap_, size_, scale_factor_));
+}
+
+Canvas::Pixels Canvas::LockPixels() {
+  DCHECK(!pixels_locked_);
+  pixels_locked_ = true;
+  PlatformLockPixels();
+  return PlatformGetPixels();
+}
+
+void Canvas::UnlockPixels() {
+  DCHECK(pixels_locked_);
+  pixels_locked_ = false;
+  PlatformUnlockPixels();
+}
+
+Size Canvas::GetPixelSize() const {
+  Pixels pixels = PlatformGetPixels();
+  return Size(pixels.width, pixels.height);
+}
+
+Buffer Canvas::GetImageData(const Rect& rect) {
+  if (rect.IsEmpty() || !Rect(GetPixelSize()).Contains(rect))
+    return Buffer();
+  size_t row_size = rect.width() * 4;
+  size_t size = row_size * rect.height();
+  uint8_t* data = static_cast<uint8_t*>(malloc(size));
+  Pixels pixels = LockPixels();
+  const uint8_t* src = pixels.data + rect.y() * pixels.stride + rect.x() * 4;
+  for (int y = 0; y < rect.height(); ++y, src += pixels.stride)
+    memcpy(data + y * row_size, src, row_size);
+  // Do not use UnlockPixels since the pixels are not modified.
+  pixels_locked_ = false;
+  return Buffer::TakeOver(data, size, free);
+}
+
+bool Canvas::PutImageData(const Buffer& data, const Rect& rect) {
+  if (rect.IsEmpty() || !Rect(GetPixelSize()).Contains(rect))
+    return false;
+  size_t row_size = rect.width() * 4;
+  if (data.size() < row_size * rect.height())
+    return false;
+  const uint8_t* src = static_cast<const uint8_t*>(data.content());
+  Pixels pixels = LockPixels();
+  uint8_t* dest = pixels.data + rect.y() * pixels.stride + rect.x() * 4;
+  for (int y = 0; y < rect.height(); ++y, dest += pixels.stride)
+    memcpy(dest, src + y * row_size, row_size);
+  UnlockPixels();
+  return true;
+}
+
 }  // namespace nu
@@ -5,15 +5,19 @@
 #ifndef NATIVEUI_GFX_CANVAS_H_
 #define NATIVEUI_GFX_CANVAS_H_
 
+#include <stdint.h>
+
 #include <memory>
 
 #include "base/memory/ref_counted.h"
+#include "nativeui/gfx/geometry/rect.h"
 #include "nativeui/gfx/geometry/size_f.h"
 #include "nativeui/nativeui_export.h"
 #include "nativeui/types.h"
 
 namespace nu {
 
+class Buffer;
 class Painter;
 
 class NATIVEUI_EXPORT Canvas : public base::RefCounted<Canvas> {
@@ -35,6 +39,45 @@ class NATIVEUI_EXPORT Canvas : public base::RefCounted<Canvas> {
   // Return the size of canvas.
   SizeF GetSize() const { return size_; }
 
+  // Change the size of canvas, the content is cleared. On Linux the memory of
+  // pixels is kept when shrinking.
+  //
+  // Note that the Painter is recreated.
+  void Resize(const SizeF& size);
+
+  // The memory of canvas's pixels.
+  //
+  // Each pixel is a 32-bit integer in native byte order, with alpha in the
+  // highest 8 bits, followed by red, green and blue. The colors are
+  // premultiplied by alpha, except on Windows.
+  struct Pixels {
+    // The first row of pixels.
+    uint8_t* data = nullptr;
+    int width = 0;
+    int height = 0;
+    // Bytes between the starts of rows, which is negative when rows are stored
+    // from bottom to top.
+    int stride = 0;
+  };
+
+  // Finish pending drawing and return the pixels for direct access. The
+  // UnlockPixels must be called before drawing on the canvas again.
+  Pixels LockPixels();
+  void UnlockPixels();
+
+  // Return the size of canvas in pixels.
+  Size GetPixelSize() const;
+
+  // Return a copy of pixels in |rect|, with rows of |rect.width()| pixels.
+  // The |rect| is in pixels, and an empty buffer is returned if it is out of
+  // canvas.
+  Buffer GetImageData(const Rect& rect);
+
+  // Copy pixels in |data| into |rect|, the |data| has rows of |rect.width()|
+  // pixels in the same format with Pixels. Return false if |rect| is out of
+  // canvas or the |data| is not large enough.
+  bool PutImageData(const Buffer& data, const Rect& rect);
+
   // Internal: Return the native bitmap object.
   NativeBitmap GetBitmap() const { return bitmap_; }
 
@@ -48,15 +91,23 @@ class NATIVEUI_EXPORT Canvas : public base::RefCounted<Canvas> {
   static NativeBitmap PlatformCreateBitmap(const SizeF& size,
                                            float scale_factor);
   static void PlatformDestroyBitmap(NativeBitmap bitmap);
+  static NativeBitmap PlatformResizeBitmap(NativeBitmap bitmap,
+                                           const SizeF& size,
+                                           float scale_factor);
   static Painter* PlatformCreatePainter(NativeBitmap bitmap,
                                         const SizeF& size,
                                         float scale_factor);
+  Pixels PlatformGetPixels() const;
+  void PlatformLockPixels();
+  void PlatformUnlockPixels();
 
   float scale_factor_;
   SizeF size_;
 
   NativeBitmap bitmap_;
   std::unique_ptr<Painter> painter_;
+
+  bool pixels_locked_ = false;
 };
 
 }  // namespace nu
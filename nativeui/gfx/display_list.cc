@@ -0,0 +1,584 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/display_list.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "nativeui/gfx/attributed_text.h"
+#include "nativeui/gfx/canvas.h"
+#include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
+
+namespace nu {
+
+namespace {
+
+// Bounds of commands that may draw anywhere.
+RectF GetUnboundedRect() {
+  return RectF(-FLT_MAX / 2, -FLT_MAX / 2, FLT_MAX, FLT_MAX);
+}
+
+// Unlike UnionRects, empty rects like points are not ignored.
+RectF UnionBounds(const RectF& a, const RectF& b) {
+  float left = std::min(a.x(), b.x());
+  float top = std::min(a.y(), b.y());
+  float right = std::max(a.right(), b.right());
+  float bottom = std::max(a.bottom(), b.bottom());
+  return RectF(left, top, right - left, bottom - top);
+}
+
+}  // namespace
+
+DisplayList::DisplayList(const SizeF& size) : size_(size) {}
+
+DisplayList::~DisplayList() {}
+
+void DisplayList::Replay(Painter* painter, const RectF& dirty) const {
+  painter->Save();
+  painter->ClipRect(dirty);
+  const float* f = floats_.data();
+  const uint32_t* i = ints_.data();
+  const RectF* bounds = bounds_.data();
+  auto image = images_.begin();
+  auto canvas = canvases_.begin();
+  auto text = texts_.begin();
+  auto path = paths_.begin();
+  // Unbalanced Save/Restore in recorded commands must not affect the states
+  // out of the list.
+  int depth = 0;
+  for (Op op : ops_) {
+    // Skip drawing that does not intersect with the dirty rect, the path is
+    // cleared as if it were consumed.
+    if (op >= Op::Stroke && !(bounds++)->Intersects(dirty)) {
+      switch (op) {
+        case Op::Stroke:
+        case Op::Fill:
+#if defined(OS_LINUX)
+        case Op::DrawPath:
+#endif
+        case Op::FillPath:
+        case Op::StrokePath:
+          painter->BeginPath();
+          break;
+        case Op::StrokeRect:
+        case Op::FillRect:
+        case Op::DrawImage:
+        case Op::DrawCanvas:
+        case Op::DrawAttributedText:
+          f += 4;
+          break;
+        case Op::DrawImageFromRect:
+        case Op::DrawCanvasFromRect:
+          f += 8;
+          break;
+        case Op::FillRects:
+          f += i[0] * 4;
+          i += 2 + i[1];
+          break;
+        case Op::StrokePolyline:
+          f += *i++ * 2;
+          break;
+        case Op::DrawPoints:
+          f += 1 + i[0] * 2;
+          i += 2 + i[1];
+          break;
+        default:
+          break;
+      }
+      if (op == Op::DrawImage || op == Op::DrawImageFromRect)
+        ++image;
+      else if (op == Op::DrawCanvas || op == Op::DrawCanvasFromRect)
+        ++canvas;
+      else if (op == Op::DrawAttributedText)
+        ++text;
+      else if (op == Op::FillPath || op == Op::StrokePath)
+        ++path;
+      continue;
+    }
+    switch (op) {
+      case Op::Save:
+        ++depth;
+        painter->Save();
+        break;
+      case Op::Restore:
+        if (depth > 0) {
+          --depth;
+          painter->Restore();
+        }
+        break;
+      case Op::SetBlendMode:
+        painter->SetBlendMode(static_cast<BlendMode>(*i++));
+        break;
+      case Op::BeginPath:
+        painter->BeginPath();
+        break;
+      case Op::ClosePath:
+        painter->ClosePath();
+        break;
+      case Op::MoveTo:
+        painter->MoveTo(PointF(f[0], f[1]));
+        f += 2;
+        break;
+      case Op::LineTo:
+        painter->LineTo(PointF(f[0], f[1]));
+        f += 2;
+        break;
+      case Op::BezierCurveTo:
+        painter->BezierCurveTo(PointF(f[0], f[1]), PointF(f[2], f[3]),
+                               PointF(f[4], f[5]));
+        f += 6;
+        break;
+      case Op::Arc:
+        painter->Arc(PointF(f[0], f[1]), f[2], f[3], f[4]);
+        f += 5;
+        break;
+      case Op::Rect:
+        painter->Rect(RectF(f[0], f[1], f[2], f[3]));
+        f += 4;
+        break;
+      case Op::Clip:
+        painter->Clip();
+        break;
+      case Op::ClipRect:
+        painter->ClipRect(RectF(f[0], f[1], f[2], f[3]));
+        f += 4;
+        break;
+      case Op::Translate:
+        painter->Translate(Vector2dF(f[0], f[1]));
+        f += 2;
+        break;
+      case Op::Rotate:
+        painter->Rotate(*f++);
+        break;
+      case Op::Scale:
+        painter->Scale(Vector2dF(f[0], f[1]));
+        f += 2;
+        break;
+      case Op::SetColor:
+        painter->SetColor(Color(*i++));
+        break;
+      case Op::SetStrokeColor:
+        painter->SetStrokeColor(Color(*i++));
+        break;
+      case Op::SetFillColor:
+        painter->SetFillColor(Color(*i++));
+        break;
+      case Op::SetLineWidth:
+        painter->SetLineWidth(*f++);
+        break;
+#if defined(OS_LINUX)
+      case Op::SetUseGlyphAtlas:
+        painter->SetUseGlyphAtlas(*i++ != 0);
+        break;
+#endif
+      case Op::Stroke:
+        painter->Stroke();
+        break;
+      case Op::Fill:
+        painter->Fill();
+        break;
+      case Op::Clear:
+        painter->Clear();
+        break;
+      case Op::StrokeRect:
+        painter->StrokeRect(RectF(f[0], f[1], f[2], f[3]));
+        f += 4;
+        break;
+      case Op::FillRect:
+        painter->FillRect(RectF(f[0], f[1], f[2], f[3]));
+        f += 4;
+        break;
+#if defined(OS_LINUX)
+      case Op::DrawPath:
+        painter->DrawPath();
+        break;
+#endif
+      case Op::FillPath:
+        painter->FillPath((path++)->get());
+        break;
+      case Op::StrokePath:
+        painter->StrokePath((path++)->get());
+        break;
+      case Op::FillRects: {
+        size_t count = *i++;
+        size_t color_count = *i++;
+        painter->FillRects(Buffer::Wrap(f, count * 4 * sizeof(float)),
+                           Buffer::Wrap(i, color_count * sizeof(uint32_t)));
+        f += count * 4;
+        i += color_count;
+        break;
+      }
+      case Op::StrokePolyline: {
+        size_t count = *i++;
+        painter->StrokePolyline(Buffer::Wrap(f, count * 2 * sizeof(float)));
+        f += count * 2;
+        break;
+      }
+      case Op::DrawPoints: {
+        size_t count = *i++;
+        size_t color_count = *i++;
+        painter->DrawPoints(Buffer::Wrap(f + 1, count * 2 * sizeof(float)),
+                            f[0],
+                            Buffer::Wrap(i, color_count * sizeof(uint32_t)));
+        f += 1 + count * 2;
+        i += color_count;
+        break;
+      }
+      case Op::DrawImage:
+        painter->DrawImage((image++)->get(), RectF(f[0], f[1], f[2], f[3]));
+        f += 4;
+        break;
+      case Op::DrawImageFromRect:
+        painter->DrawImageFromRect((image++)->get(),
+                                   RectF(f[0], f[1], f[2], f[3]),
+                                   RectF(f[4], f[5], f[6], f[7]));
+        f += 8;
+        break;
+      case Op::DrawCanvas:
+        painter->DrawCanvas((canvas++)->get(), RectF(f[0], f[1], f[2], f[3]));
+        f += 4;
+        break;
+      case Op::DrawCanvasFromRect:
+        painter->DrawCanvasFromRect((canvas++)->get(),
+                                    RectF(f[0], f[1], f[2], f[3]),
+                                    RectF(f[4], f[5], f[6], f[7]));
+        f += 8;
+        break;
+      case Op::DrawAttributedText:
+        painter->DrawAttributedText(*text++, RectF(f[0], f[1], f[2], f[3]));
+        f += 4;
+        break;
+    }
+  }
+  for (; depth > 0; --depth)
+    painter->Restore();
+  painter->Restore();
+}
+
+RecordingPainter::RecordingPainter(DisplayList* list) : list_(list) {
+  states_.emplace_back();
+}
+
+RecordingPainter::~RecordingPainter() {}
+
+void RecordingPainter::Save() {
+  states_.push_back(states_.back());
+  Push(Op::Save);
+}
+
+void RecordingPainter::Restore() {
+  if (states_.size() > 1)
+    states_.pop_back();
+  Push(Op::Restore);
+}
+
+void RecordingPainter::SetBlendMode(BlendMode mode) {
+  Push(Op::SetBlendMode);
+  list_->ints_.push_back(static_cast<uint32_t>(mode));
+}
+
+void RecordingPainter::BeginPath() {
+  has_path_ = false;
+  Push(Op::BeginPath);
+}
+
+void RecordingPainter::ClosePath() {
+  Push(Op::ClosePath);
+}
+
+void RecordingPainter::MoveTo(const PointF& point) {
+  AddToPath(RectF(point, SizeF()));
+  Push(Op::MoveTo, {point.x(), point.y()});
+}
+
+void RecordingPainter::LineTo(const PointF& point) {
+  AddToPath(RectF(point, SizeF()));
+  Push(Op::LineTo, {point.x(), point.y()});
+}
+
+void RecordingPainter::BezierCurveTo(const PointF& cp1,
+                                     const PointF& cp2,
+                                     const PointF& ep) {
+  // The curve is inside the convex hull of control points.
+  AddToPath(RectF(cp1, SizeF()));
+  AddToPath(RectF(cp2, SizeF()));
+  AddToPath(RectF(ep, SizeF()));
+  Push(Op::BezierCurveTo,
+       {cp1.x(), cp1.y(), cp2.x(), cp2.y(), ep.x(), ep.y()});
+}
+
+void RecordingPainter::Arc(const PointF& point, float radius,
+                           float sa, float ea) {
+  AddToPath(RectF(point.x() - radius, point.y() - radius,
+                  radius * 2, radius * 2));
+  Push(Op::Arc, {point.x(), point.y(), radius, sa, ea});
+}
+
+void RecordingPainter::Rect(const RectF& rect) {
+  AddToPath(rect);
+  Push(Op::Rect, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void RecordingPainter::Clip() {
+  has_path_ = false;
+  Push(Op::Clip);
+}
+
+void RecordingPainter::ClipRect(const RectF& rect) {
+  Push(Op::ClipRect, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void RecordingPainter::Translate(const Vector2dF& offset) {
+  State& state = states_.back();
+  state.tx += offset.x() * state.sx;
+  state.ty += offset.y() * state.sy;
+  Push(Op::Translate, {offset.x(), offset.y()});
+}
+
+void RecordingPainter::Rotate(float angle) {
+  states_.back().rotated = true;
+  Push(Op::Rotate, {angle});
+}
+
+void RecordingPainter::Scale(const Vector2dF& scale) {
+  State& state = states_.back();
+  state.sx *= scale.x();
+  state.sy *= scale.y();
+  Push(Op::Scale, {scale.x(), scale.y()});
+}
+
+void RecordingPainter::SetColor(Color color) {
+  Push(Op::SetColor);
+  list_->ints_.push_back(color.value());
+}
+
+void RecordingPainter::SetStrokeColor(Color color) {
+  Push(Op::SetStrokeColor);
+  list_->ints_.push_back(color.value());
+}
+
+void RecordingPainter::SetFillColor(Color color) {
+  Push(Op::SetFillColor);
+  list_->ints_.push_back(color.value());
+}
+
+void RecordingPainter::SetLineWidth(float width) {
+  states_.back().line_width = width;
+  Push(Op::SetLineWidth, {width});
+}
+
+void RecordingPainter::Stroke() {
+  PushDraw(Op::Stroke, has_path_ ? GetStrokeBounds(path_bounds_) : RectF());
+  has_path_ = false;
+}
+
+void RecordingPainter::Fill() {
+  PushDraw(Op::Fill, has_path_ ? path_bounds_ : RectF());
+  has_path_ = false;
+}
+
+void RecordingPainter::Clear() {
+  PushDraw(Op::Clear, GetUnboundedRect());
+}
+
+void RecordingPainter::StrokeRect(const RectF& rect) {
+  PushDraw(Op::StrokeRect, GetStrokeBounds(MapRect(rect)));
+  list_->floats_.insert(list_->floats_.end(),
+                        {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void RecordingPainter::FillRect(const RectF& rect) {
+  PushDraw(Op::FillRect, MapRect(rect));
+  list_->floats_.insert(list_->floats_.end(),
+                        {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+#if defined(OS_LINUX)
+void RecordingPainter::DrawPath() {
+  PushDraw(Op::DrawPath, has_path_ ? GetStrokeBounds(path_bounds_) : RectF());
+  has_path_ = false;
+}
+#endif
+
+void RecordingPainter::FillPath(const Path* path) {
+  PushDraw(Op::FillPath, MapRect(path->GetBounds()));
+  list_->paths_.push_back(path);
+  has_path_ = false;
+}
+
+void RecordingPainter::StrokePath(const Path* path) {
+  PushDraw(Op::StrokePath, GetStrokeBounds(MapRect(path->GetBounds())));
+  list_->paths_.push_back(path);
+  has_path_ = false;
+}
+
+void RecordingPainter::FillRects(const Buffer& rects, const Buffer& colors) {
+  size_t count = GetBatchSize(rects, 4, colors);
+  list_->ints_.push_back(static_cast<uint32_t>(count));
+  PushBatchColors(colors, count);
+  RectF bounds = PushBatch(rects, 4, count);
+  PushDraw(Op::FillRects, MapRect(bounds));
+  has_path_ = false;
+}
+
+void RecordingPainter::StrokePolyline(const Buffer& points) {
+  size_t count = GetBatchSize(points, 2, Buffer());
+  list_->ints_.push_back(static_cast<uint32_t>(count));
+  RectF bounds = PushBatch(points, 2, count);
+  PushDraw(Op::StrokePolyline, GetStrokeBounds(MapRect(bounds)));
+  has_path_ = false;
+}
+
+void RecordingPainter::DrawPoints(const Buffer& points,
+                                  float diameter,
+                                  const Buffer& colors) {
+  size_t count = GetBatchSize(points, 2, colors);
+  list_->ints_.push_back(static_cast<uint32_t>(count));
+  PushBatchColors(colors, count);
+  list_->floats_.push_back(diameter);
+  RectF bounds = PushBatch(points, 2, count);
+  if (count > 0)
+    bounds.Inset(-diameter / 2, -diameter / 2);
+  PushDraw(Op::DrawPoints, MapRect(bounds));
+  has_path_ = false;
+}
+
+void RecordingPainter::DrawImage(const Image* image, const RectF& rect) {
+  PushDraw(Op::DrawImage, MapRect(rect));
+  list_->floats_.insert(list_->floats_.end(),
+                        {rect.x(), rect.y(), rect.width(), rect.height()});
+  list_->images_.push_back(image);
+}
+
+void RecordingPainter::DrawImageFromRect(const Image* image, const RectF& src,
+                                         const RectF& dest) {
+  PushDraw(Op::DrawImageFromRect, MapRect(dest));
+  list_->floats_.insert(list_->floats_.end(),
+                        {src.x(), src.y(), src.width(), src.height(),
+                         dest.x(), dest.y(), dest.width(), dest.height()});
+  list_->images_.push_back(image);
+}
+
+void RecordingPainter::DrawCanvas(Canvas* canvas, const RectF& rect) {
+  PushDraw(Op::DrawCanvas, MapRect(rect));
+  list_->floats_.insert(list_->floats_.end(),
+                        {rect.x(), rect.y(), rect.width(), rect.height()});
+  list_->canvases_.push_back(canvas);
+}
+
+void RecordingPainter::DrawCanvasFromRect(Canvas* canvas, const RectF& src,
+                                          const RectF& dest) {
+  PushDraw(Op::DrawCanvasFromRect, MapRect(dest));
+  list_->floats_.insert(list_->floats_.end(),
+                        {src.x(), src.y(), src.width(), src.height(),
+                         dest.x(), dest.y(), dest.width(), dest.height()});
+  list_->canvases_.push_back(canvas);
+}
+
+void RecordingPainter::DrawAttributedText(scoped_refptr<AttributedText> text,
+                                          const RectF& rect) {
+  PushDraw(Op::DrawAttributedText, MapRect(rect));
+  list_->floats_.insert(list_->floats_.end(),
+                        {rect.x(), rect.y(), rect.width(), rect.height()});
+  list_->texts_.push_back(std::move(text));
+}
+
+// Everything is dirty, since the list may be replayed on any area.
+std::vector<RectF> RecordingPainter::GetDirtyRects() {
+  return {GetUnboundedRect()};
+}
+
+bool RecordingPainter::IsRectDirty(const RectF& rect) {
+  return true;
+}
+
+#if defined(OS_LINUX)
+void RecordingPainter::SetUseGlyphAtlas(bool use) {
+  Push(Op::SetUseGlyphAtlas);
+  list_->ints_.push_back(use ? 1 : 0);
+}
+#endif
+
+void RecordingPainter::Push(Op op, std::initializer_list<float> args) {
+  list_->ops_.push_back(op);
+  list_->floats_.insert(list_->floats_.end(), args);
+}
+
+void RecordingPainter::PushDraw(Op op, const RectF& bounds) {
+  list_->ops_.push_back(op);
+  list_->bounds_.push_back(bounds);
+}
+
+RectF RecordingPainter::PushBatch(const Buffer& data,
+                                  size_t size,
+                                  size_t count) {
+  if (count == 0)
+    return RectF();
+  size_t offset = list_->floats_.size();
+  list_->floats_.resize(offset + count * size);
+  float* f = list_->floats_.data() + offset;
+  memcpy(f, data.content(), count * size * sizeof(float));
+  // The items of rects have sizes after the origin.
+  float left = FLT_MAX, top = FLT_MAX, right = -FLT_MAX, bottom = -FLT_MAX;
+  for (size_t i = 0; i < count; ++i, f += size) {
+    float x2 = size == 4 ? f[0] + f[2] : f[0];
+    float y2 = size == 4 ? f[1] + f[3] : f[1];
+    left = std::min(left, std::min(f[0], x2));
+    top = std::min(top, std::min(f[1], y2));
+    right = std::max(right, std::max(f[0], x2));
+    bottom = std::max(bottom, std::max(f[1], y2));
+  }
+  return RectF(left, top, right - left, bottom - top);
+}
+
+void RecordingPainter::PushBatchColors(const Buffer& colors, size_t count) {
+  if (colors.size() == 0) {
+    list_->ints_.push_back(0);
+    return;
+  }
+  list_->ints_.push_back(static_cast<uint32_t>(count));
+  size_t offset = list_->ints_.size();
+  list_->ints_.resize(offset + count);
+  memcpy(list_->ints_.data() + offset, colors.content(),
+         count * sizeof(uint32_t));
+}
+
+RectF RecordingPainter::MapRect(const RectF& rect) const {
+  const State& state = states_.back();
+  if (state.rotated)
+    return GetUnboundedRect();
+  float x1 = rect.x() * state.sx + state.tx;
+  float y1 = rect.y() * state.sy + state.ty;
+  float x2 = rect.right() * state.sx + state.tx;
+  float y2 = rect.bottom() * state.sy + state.ty;
+  return RectF(std::min(x1, x2), std::min(y1, y2),
+               fabsf(x2 - x1), fabsf(y2 - y1));
+}
+
+void RecordingPainter::AddToPath(const RectF& rect) {
+  RectF bounds = MapRect(rect);
+  if (has_path_) {
+    path_bounds_ = UnionBounds(path_bounds_, bounds);
+  } else {
+    path_bounds_ = bounds;
+    has_path_ = true;
+  }
+}
+
+RectF RecordingPainter::GetStrokeBounds(const RectF& rect) const {
+  const State& state = states_.back();
+  float outset = state.line_width / 2 *
+                 std::max(fabsf(state.sx), fabsf(state.sy));
+  RectF bounds = rect;
+  bounds.Inset(-outset, -outset);
+  return bounds;
+}
+
+}  // namespace nu
@@ -0,0 +1,196 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_DISPLAY_LIST_H_
+#define NATIVEUI_GFX_DISPLAY_LIST_H_
+
+#include <stdint.h>
+
+#include <initializer_list>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/geometry/rect_f.h"
+#include "nativeui/gfx/painter.h"
+
+namespace nu {
+
+// Commands recorded by RecordingPainter, which can be replayed on any painter.
+//
+// Each drawing command keeps the bounds it draws on, so replaying with a dirty
+// rect skips the commands that do not affect it.
+class NATIVEUI_EXPORT DisplayList : public base::RefCounted<DisplayList> {
+ public:
+  explicit DisplayList(const SizeF& size);
+
+  // Draw the commands on |painter|, clipped to |dirty|.
+  void Replay(Painter* painter, const RectF& dirty) const;
+
+  // Return the size of the view when recording.
+  SizeF GetSize() const { return size_; }
+
+  // Return the number of recorded commands.
+  size_t GetCommandCount() const { return ops_.size(); }
+
+ protected:
+  virtual ~DisplayList();
+
+ private:
+  friend class base::RefCounted<DisplayList>;
+  friend class RecordingPainter;
+
+  enum class Op : uint8_t {
+    Save,
+    Restore,
+    SetBlendMode,
+    BeginPath,
+    ClosePath,
+    MoveTo,
+    LineTo,
+    BezierCurveTo,
+    Arc,
+    Rect,
+    Clip,
+    ClipRect,
+    Translate,
+    Rotate,
+    Scale,
+    SetColor,
+    SetStrokeColor,
+    SetFillColor,
+    SetLineWidth,
+#if defined(OS_LINUX)
+    SetUseGlyphAtlas,
+#endif
+    // Following commands draw, and have bounds.
+    Stroke,
+    Fill,
+    Clear,
+    StrokeRect,
+    FillRect,
+#if defined(OS_LINUX)
+    DrawPath,
+#endif
+    FillPath,
+    StrokePath,
+    FillRects,
+    StrokePolyline,
+    DrawPoints,
+    DrawImage,
+    DrawImageFromRect,
+    DrawCanvas,
+    DrawCanvasFromRect,
+    DrawAttributedText,
+  };
+
+  SizeF size_;
+
+  // Arguments of commands are stored in separate arrays, and are read in
+  // order when replaying.
+  std::vector<Op> ops_;
+  std::vector<float> floats_;
+  std::vector<uint32_t> ints_;
+  std::vector<RectF> bounds_;
+  std::vector<scoped_refptr<const Image>> images_;
+  std::vector<scoped_refptr<Canvas>> canvases_;
+  std::vector<scoped_refptr<AttributedText>> texts_;
+  std::vector<scoped_refptr<const Path>> paths_;
+};
+
+// A painter that records commands into DisplayList instead of drawing.
+class NATIVEUI_EXPORT RecordingPainter : public Painter {
+ public:
+  explicit RecordingPainter(DisplayList* list);
+  ~RecordingPainter() override;
+
+  // Painter:
+  void Save() override;
+  void Restore() override;
+  void SetBlendMode(BlendMode mode) override;
+  void BeginPath() override;
+  void ClosePath() override;
+  void MoveTo(const PointF& point) override;
+  void LineTo(const PointF& point) override;
+  void BezierCurveTo(const PointF& cp1,
+                     const PointF& cp2,
+                     const PointF& ep) override;
+  void Arc(const PointF& point, float radius, float sa, float ea) override;
+  void Rect(const RectF& rect) override;
+  void Clip() override;
+  void ClipRect(const RectF& rect) override;
+  void Translate(const Vector2dF& offset) override;
+  void Rotate(float angle) override;
+  void Scale(const Vector2dF& scale) override;
+  void SetColor(Color color) override;
+  void SetStrokeColor(Color color) override;
+  void SetFillColor(Color color) override;
+  void SetLineWidth(float width) override;
+  void Stroke() override;
+  void Fill() override;
+  void Clear() override;
+  void StrokeRect(const RectF& rect) override;
+  void FillRect(const RectF& rect) override;
+#if defined(OS_LINUX)
+  void DrawPath() override;
+#endif
+  void FillPath(const Path* path) override;
+  void StrokePath(const Path* path) override;
+  void FillRects(const Buffer& rects, const Buffer& colors) override;
+  void StrokePolyline(const Buffer& points) override;
+  void DrawPoints(const Buffer& points,
+                  float diameter,
+                  const Buffer& colors) override;
+  void DrawImage(const Image* image, const RectF& rect) override;
+  void DrawImageFromRect(const Image* image, const RectF& src,
+                         const RectF& dest) override;
+  void DrawCanvas(Canvas* canvas, const RectF& rect) override;
+  void DrawCanvasFromRect(Canvas* canvas, const RectF& src,
+                          const RectF& dest) override;
+  void DrawAttributedText(scoped_refptr<AttributedText> text,
+                          const RectF& rect) override;
+  std::vector<RectF> GetDirtyRects() override;
+  bool IsRectDirty(const RectF& rect) override;
+#if defined(OS_LINUX)
+  void SetUseGlyphAtlas(bool use) override;
+#endif
+
+ private:
+  using Op = DisplayList::Op;
+
+  void Push(Op op) { list_->ops_.push_back(op); }
+  void Push(Op op, std::initializer_list<float> args);
+  void PushDraw(Op op, const RectF& bounds);
+
+  // Copy |count| items of batched drawing into the list, and return the bounds
+  // of the points in them.
+  RectF PushBatch(const Buffer& data, size_t size, size_t count);
+  void PushBatchColors(const Buffer& colors, size_t count);
+
+  // Bounds in the view's coordinates.
+  RectF MapRect(const RectF& rect) const;
+  void AddToPath(const RectF& rect);
+  RectF GetStrokeBounds(const RectF& rect) const;
+
+  // Only translation and scaling are tracked, the bounds of commands drawn
+  // after rotation are unknown.
+  struct State {
+    float tx = 0;
+    float ty = 0;
+    float sx = 1;
+    float sy = 1;
+    bool rotated = false;
+    float line_width = 1;
+  };
+  std::vector<State> states_;
+
+  // Bounds of current path.
+  RectF path_bounds_;
+  bool has_path_ = false;
+
+  DisplayList* list_;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_DISPLAY_LIST_H_
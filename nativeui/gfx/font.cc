@@ -4,6 +4,13 @@
 
 #include "nativeui/gfx/font.h"
 
+#include <inttypes.h>
+
+#include <string>
+#include <utility>
+
+#include "base/files/file_util.h"
+#include "base/strings/stringprintf.h"
 #include "nativeui/state.h"
 
 namespace nu {
@@ -16,8 +23,58 @@ Font* Font::Default() {
   return default_font.get();
 }
 
-Font* Font::Derive(float size_delta, Weight weight, Style style) const {
-  return new Font(GetName(), GetSize() + size_delta, weight, style);
+// static
+scoped_refptr<Font> Font::Get(const std::string& name,
+                              float size,
+                              Weight weight,
+                              Style style) {
+  std::string key = base::StringPrintf("name:%a:%d:%d:%s", size,
+                                       static_cast<int>(weight),
+                                       static_cast<int>(style), name.c_str());
+  auto& fonts = State::GetCurrent()->fonts();
+  auto it = fonts.find(key);
+  if (it != fonts.end())
+    return it->second;
+  Font* font = new Font(name, size, weight, style);
+  font->cache_key_ = key;
+  fonts[std::move(key)] = font;
+  return font;
+}
+
+// static
+scoped_refptr<Font> Font::GetFromPath(const base::FilePath& path, float size) {
+  // A file that can not be read gets null time, and is retried when changed.
+  base::File::Info info;
+  base::GetFileInfo(path, &info);
+  std::string key = base::StringPrintf(
+      "path:%a:%" PRId64 ":%s", size, info.last_modified.ToInternalValue(),
+      path.AsUTF8Unsafe().c_str());
+  auto& fonts = State::GetCurrent()->fonts();
+  auto it = fonts.find(key);
+  if (it != fonts.end())
+    return it->second;
+  Font* font = new Font(path, size);
+  font->cache_key_ = key;
+  fonts[std::move(key)] = font;
+  return font;
+}
+
+scoped_refptr<Font> Font::Derive(float size_delta,
+                                 Weight weight,
+                                 Style style) const {
+  return Get(GetName(), GetSize() + size_delta, weight, style);
+}
+
+void Font::Uncache() {
+  // Fonts referenced by language bindings may outlive the state.
+  State* state = State::GetCurrent();
+  if (cache_key_.empty() || !state)
+    return;
+  // The key may have been taken by another font in a new state.
+  auto& fonts = state->fonts();
+  auto it = fonts.find(cache_key_);
+  if (it != fonts.end() && it->second == this)
+    fonts.erase(it);
 }
 
 }  // namespace nu
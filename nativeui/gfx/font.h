@@ -60,9 +60,21 @@ class NATIVEUI_EXPORT Font : public base::RefCounted<Font> {
   // Create from from file path.
   Font(const base::FilePath& path, float size);
 
-  // Returns a new Font derived from the existing font.
-  // It is caller's responsibility to manage the lifetime of returned font.
-  Font* Derive(float size_delta, Weight weight, Style style) const;
+  // Return a font with the specified properties. Fonts are interned, the same
+  // instance is returned for the same arguments while it is alive.
+  static scoped_refptr<Font> Get(const std::string& name,
+                                 float size,
+                                 Weight weight,
+                                 Style style);
+
+  // Return an interned font created from file, the file is only loaded again
+  // when its modification time changes.
+  static scoped_refptr<Font> GetFromPath(const base::FilePath& path,
+                                         float size);
+
+  // Returns a Font derived from the existing font.
+  scoped_refptr<Font> Derive(float size_delta, Weight weight,
+                             Style style) const;
 
   // Return the specified font name in UTF-8.
   std::string GetName() const;
@@ -96,8 +108,14 @@ class NATIVEUI_EXPORT Font : public base::RefCounted<Font> {
  private:
   friend class base::RefCounted<Font>;
 
+  // Remove the font from the interned fonts, called by destructor.
+  void Uncache();
+
   NativeFont font_;
 
+  // The key in interned fonts, empty if not interned.
+  std::string cache_key_;
+
 #if defined(OS_WIN)
   // Cached PrivateFontCollection, used by fonts created from paths.
   std::unique_ptr<Gdiplus::PrivateFontCollection> font_collection_;
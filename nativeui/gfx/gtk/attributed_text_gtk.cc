@@ -14,7 +14,9 @@
 #include "nativeui/gfx/font.h"
 #include "nativeui/gfx/geometry/rect_f.h"
 #include "nativeui/gfx/geometry/size_f.h"
+#include "nativeui/gfx/gtk/text_shaper.h"
 #include "nativeui/gfx/text.h"
+#include "nativeui/state.h"
 
 namespace nu {
 
@@ -119,7 +121,7 @@ void AttributedText::PlatformSetColorFor(Color color, int start, int end) {
   pango_attr_list_insert(attrs, fg_attr);  // ownership taken
 }
 
-RectF AttributedText::GetBoundsFor(const SizeF& size) const {
+void AttributedText::SetLayoutSize(const SizeF& size) const {
   if (format_.wrap) {
     // Yoga may pass 0 as width to indicate no wrapping.
     if (size.width() == 0 || isnan(size.width()))
@@ -128,12 +130,33 @@ RectF AttributedText::GetBoundsFor(const SizeF& size) const {
       pango_layout_set_width(text_, size.width() * PANGO_SCALE);
     pango_layout_set_height(text_, size.height() * PANGO_SCALE);
   }
+}
+
+RectF AttributedText::PlatformGetBoundsFor(const SizeF& size) const {
+  SetLayoutSize(size);
   int width, height;
   pango_layout_get_pixel_size(text_, &width, &height);
   return RectF(0, 0, width, height);
 }
 
-void AttributedText::SetText(const std::string& text) {
+// static
+void AttributedText::MeasureInParallel(
+    const std::vector<AttributedText*>& texts) {
+  std::vector<TextShaper::Job> jobs(texts.size());
+  for (size_t i = 0; i < texts.size(); ++i) {
+    PangoLayout* layout = texts[i]->text_;
+    TextShaper::Job& job = jobs[i];
+    job.text = pango_layout_get_text(layout);
+    job.attrs = pango_attr_list_copy(pango_layout_get_attributes(layout));
+    job.alignment = pango_layout_get_alignment(layout);
+    job.ellipsize = pango_layout_get_ellipsize(layout);
+  }
+  State::GetCurrent()->GetTextShaper()->Measure(&jobs);
+  for (size_t i = 0; i < texts.size(); ++i)
+    texts[i]->natural_bounds_ = RectF(0, 0, jobs[i].width, jobs[i].height);
+}
+
+void AttributedText::PlatformSetText(const std::string& text) {
   pango_layout_set_text(text_, text.c_str(), text.length());
 }
 
@@ -5,18 +5,18 @@
 #include "nativeui/gfx/canvas.h"
 
 #include "nativeui/gfx/gtk/painter_gtk.h"
+#include "nativeui/gfx/gtk/surface_pool.h"
+#include "nativeui/state.h"
 
 namespace nu {
 
 // static
 NativeBitmap Canvas::PlatformCreateBitmap(const SizeF& size,
                                           float scale_factor) {
-  cairo_surface_t* surface = cairo_image_surface_create(
-      CAIRO_FORMAT_ARGB32,
+  return State::GetCurrent()->GetSurfacePool()->CreateSurface(
       size.width() * scale_factor,
-      size.height() * scale_factor);
-  cairo_surface_set_device_scale(surface, scale_factor, scale_factor);
-  return surface;
+      size.height() * scale_factor,
+      scale_factor);
 }
 
 // static
@@ -24,6 +24,17 @@ void Canvas::PlatformDestroyBitmap(NativeBitmap bitmap) {
   cairo_surface_destroy(bitmap);
 }
 
+// static
+NativeBitmap Canvas::PlatformResizeBitmap(NativeBitmap bitmap,
+                                          const SizeF& size,
+                                          float scale_factor) {
+  return State::GetCurrent()->GetSurfacePool()->ResizeSurface(
+      bitmap,
+      size.width() * scale_factor,
+      size.height() * scale_factor,
+      scale_factor);
+}
+
 // static
 Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
                                        const SizeF& size,
@@ -31,4 +42,21 @@ Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
   return new PainterGtk(bitmap, size, scale_factor);
 }
 
+Canvas::Pixels Canvas::PlatformGetPixels() const {
+  Pixels pixels;
+  pixels.data = cairo_image_surface_get_data(bitmap_);
+  pixels.width = cairo_image_surface_get_width(bitmap_);
+  pixels.height = cairo_image_surface_get_height(bitmap_);
+  pixels.stride = cairo_image_surface_get_stride(bitmap_);
+  return pixels;
+}
+
+void Canvas::PlatformLockPixels() {
+  cairo_surface_flush(bitmap_);
+}
+
+void Canvas::PlatformUnlockPixels() {
+  cairo_surface_mark_dirty(bitmap_);
+}
+
 }  // namespace nu
@@ -7,8 +7,10 @@
 #include <gtk/gtk.h>
 #include <pango/pangofc-fontmap.h>
 
-#include <iostream>
+#include <map>
 
+#include "base/files/file_util.h"
+#include "base/no_destructor.h"
 #include "nativeui/gtk/util/fontconfig.h"
 
 namespace nu {
@@ -26,21 +28,49 @@ PangoFontDescription* GetDefaultFontDescription() {
   return desc;
 }
 
-PangoFontDescription* FontDescriptionFromPath(const base::FilePath& path) {
+PangoFontDescription* LoadFontDescriptionFromPath(const base::FilePath& path) {
   // Add the font path to FcConfig first.
   FcConfig* config = GetGlobalFontConfig();
   FcConfigAppFontAddFile(
       config, reinterpret_cast<const FcChar8*>(path.value().c_str()));
   FcFontSet* font_set = FcConfigGetFonts(config, FcSetApplication);
-  // And then receive the FcPattern from FcConfig.
+  // And then receive the FcPattern from FcConfig, search from the end so the
+  // latest added pattern is used when the file has changed.
   if (font_set) {
-    for (int i = 0; i < font_set->nfont; ++i) {
+    for (int i = font_set->nfont - 1; i >= 0; --i) {
       FcPattern* pattern = font_set->fonts[i];
       if (GetFilename(pattern) == path.value())
         return pango_fc_font_description_from_pattern(pattern, FALSE);
     }
   }
-  return GetDefaultFontDescription();
+  return nullptr;
+}
+
+// Adding font file to fontconfig and searching for its pattern are slow, so
+// the results are cached by path and modification time.
+struct FileFontEntry {
+  base::Time last_modified;
+  PangoFontDescription* desc;
+};
+
+PangoFontDescription* FontDescriptionFromPath(const base::FilePath& path) {
+  static base::NoDestructor<std::map<base::FilePath, FileFontEntry>> cache;
+  base::File::Info info;
+  if (!base::GetFileInfo(path, &info))
+    return GetDefaultFontDescription();
+  auto it = cache->find(path);
+  if (it != cache->end() && it->second.last_modified == info.last_modified)
+    return pango_font_description_copy(it->second.desc);
+  PangoFontDescription* desc = LoadFontDescriptionFromPath(path);
+  if (!desc)
+    return GetDefaultFontDescription();
+  if (it != cache->end()) {
+    pango_font_description_free(it->second.desc);
+    it->second = {info.last_modified, desc};
+  } else {
+    (*cache)[path] = {info.last_modified, desc};
+  }
+  return pango_font_description_copy(desc);
 }
 
 }  // namespace
@@ -63,6 +93,7 @@ Font::Font(const base::FilePath& path, float size)
 }
 
 Font::~Font() {
+  Uncache();
   pango_font_description_free(font_);
 }
 
@@ -0,0 +1,219 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/gtk/glyph_atlas.h"
+
+#include <cairo-ft.h>
+#include <math.h>
+
+#include <algorithm>
+
+namespace nu {
+
+namespace {
+
+// Each page takes 1MB, which fits thousands of glyphs of normal sizes.
+constexpr int kPageSize = 1024;
+constexpr size_t kMaxPages = 4;
+
+// Color glyphs, like emojis, can not be drawn as alpha masks.
+bool IsColorFont(cairo_scaled_font_t* scaled_font) {
+  if (cairo_scaled_font_get_type(scaled_font) != CAIRO_FONT_TYPE_FT)
+    return true;
+  FT_Face face = cairo_ft_scaled_font_lock_face(scaled_font);
+  if (!face)
+    return true;
+  bool has_color = FT_HAS_COLOR(face);
+  cairo_ft_scaled_font_unlock_face(scaled_font);
+  return has_color;
+}
+
+// Make |context| draw with the font face of |scaled_font| at |scale|.
+void SetScaledFont(cairo_t* context,
+                   cairo_scaled_font_t* scaled_font,
+                   double scale) {
+  cairo_scale(context, scale, scale);
+  cairo_set_font_face(context, cairo_scaled_font_get_font_face(scaled_font));
+  cairo_matrix_t font_matrix;
+  cairo_scaled_font_get_font_matrix(scaled_font, &font_matrix);
+  cairo_set_font_matrix(context, &font_matrix);
+  cairo_font_options_t* options = cairo_font_options_create();
+  cairo_scaled_font_get_font_options(scaled_font, options);
+  // Masks only have one channel.
+  if (cairo_font_options_get_antialias(options) == CAIRO_ANTIALIAS_SUBPIXEL)
+    cairo_font_options_set_antialias(options, CAIRO_ANTIALIAS_GRAY);
+  cairo_set_font_options(context, options);
+  cairo_font_options_destroy(options);
+}
+
+}  // namespace
+
+GlyphAtlas::GlyphAtlas()
+    : scratch_surface_(cairo_image_surface_create(CAIRO_FORMAT_A8, 1, 1)),
+      scratch_context_(cairo_create(scratch_surface_)) {}
+
+GlyphAtlas::~GlyphAtlas() {
+  Clear();
+  cairo_destroy(scratch_context_);
+  cairo_surface_destroy(scratch_surface_);
+}
+
+bool GlyphAtlas::DrawGlyphs(cairo_t* context,
+                            PangoFont* font,
+                            PangoGlyphString* glyphs,
+                            double scale,
+                            double x,
+                            double y) {
+  if (unsupported_fonts_.count(font) > 0)
+    return false;
+
+  // Collect all glyphs before drawing, so nothing is drawn on failure. The
+  // masks are referenced since the atlas may be cleared when it is full.
+  std::vector<Glyph> masks;
+  masks.reserve(glyphs->num_glyphs);
+  int pen = 0;
+  bool success = true;
+  for (int i = 0; i < glyphs->num_glyphs; ++i) {
+    const PangoGlyphInfo& info = glyphs->glyphs[i];
+    int offset = pen + info.geometry.x_offset;
+    pen += info.geometry.width;
+    if (info.glyph == PANGO_GLYPH_EMPTY)
+      continue;
+    const Glyph* glyph = (info.glyph & PANGO_GLYPH_UNKNOWN_FLAG) ?
+        nullptr : GetGlyph(font, scale, info.glyph);
+    if (!glyph) {
+      success = false;
+      break;
+    }
+    if (!glyph->mask)
+      continue;
+    Glyph mask;
+    mask.mask = cairo_pattern_reference(glyph->mask);
+    mask.x = lround(x + pango_units_to_double(offset) * scale) + glyph->x;
+    mask.y = lround(y + pango_units_to_double(info.geometry.y_offset) * scale) +
+             glyph->y;
+    masks.push_back(mask);
+  }
+
+  // The context's user space is in device pixels divided by device scale.
+  double sx = 1, sy = 1;
+  cairo_surface_get_device_scale(cairo_get_target(context), &sx, &sy);
+  for (const Glyph& mask : masks) {
+    if (success) {
+      cairo_matrix_t matrix;
+      cairo_matrix_init(&matrix, sx, 0, 0, sy, -mask.x, -mask.y);
+      cairo_pattern_set_matrix(mask.mask, &matrix);
+      cairo_mask(context, mask.mask);
+    }
+    cairo_pattern_destroy(mask.mask);
+  }
+  return success;
+}
+
+void GlyphAtlas::Clear() {
+  for (auto& it : glyphs_) {
+    if (it.second.mask)
+      cairo_pattern_destroy(it.second.mask);
+  }
+  glyphs_.clear();
+  for (PangoFont* font : fonts_)
+    g_object_unref(font);
+  fonts_.clear();
+  unsupported_fonts_.clear();
+  for (cairo_surface_t* page : pages_)
+    cairo_surface_destroy(page);
+  pages_.clear();
+  row_x_ = row_y_ = row_height_ = 0;
+}
+
+const GlyphAtlas::Glyph* GlyphAtlas::GetGlyph(PangoFont* font,
+                                              double scale,
+                                              PangoGlyph glyph) {
+  Key key(font, scale, glyph);
+  auto it = glyphs_.find(key);
+  if (it != glyphs_.end())
+    return &it->second;
+
+  cairo_scaled_font_t* scaled_font =
+      pango_cairo_font_get_scaled_font(PANGO_CAIRO_FONT(font));
+  if (!scaled_font)
+    return nullptr;
+  bool is_new_font = fonts_.count(font) == 0;
+  if (is_new_font && IsColorFont(scaled_font)) {
+    unsupported_fonts_.insert(font);
+    return nullptr;
+  }
+
+  Glyph result;
+  if (!Rasterize(scaled_font, scale, glyph, &result))
+    return nullptr;
+  // Rasterizing may clear the atlas, so the font is added after it.
+  if (fonts_.insert(font).second)
+    g_object_ref(font);
+  return &glyphs_.emplace(key, result).first->second;
+}
+
+bool GlyphAtlas::Rasterize(cairo_scaled_font_t* scaled_font,
+                           double scale,
+                           PangoGlyph glyph,
+                           Glyph* out) {
+  // Measure the ink bounds in device pixels, with 1 pixel for antialiasing.
+  cairo_glyph_t cairo_glyph = {glyph, 0, 0};
+  cairo_text_extents_t extents;
+  cairo_save(scratch_context_);
+  SetScaledFont(scratch_context_, scaled_font, scale);
+  cairo_glyph_extents(scratch_context_, &cairo_glyph, 1, &extents);
+  cairo_restore(scratch_context_);
+  if (extents.width <= 0 || extents.height <= 0)
+    return true;
+  int left = floor(extents.x_bearing * scale) - 1;
+  int top = floor(extents.y_bearing * scale) - 1;
+  int right = ceil((extents.x_bearing + extents.width) * scale) + 1;
+  int bottom = ceil((extents.y_bearing + extents.height) * scale) + 1;
+  int width = right - left;
+  int height = bottom - top;
+  // Large glyphs are better drawn directly.
+  if (width > kPageSize / 4 || height > kPageSize / 4)
+    return false;
+
+  int x, y;
+  cairo_surface_t* page = Allocate(width, height, &x, &y);
+  cairo_t* context = cairo_create(page);
+  cairo_rectangle(context, x, y, width, height);
+  cairo_clip(context);
+  cairo_translate(context, x - left, y - top);
+  SetScaledFont(context, scaled_font, scale);
+  cairo_show_glyphs(context, &cairo_glyph, 1);
+  cairo_destroy(context);
+
+  cairo_surface_t* sub = cairo_surface_create_for_rectangle(
+      page, x, y, width, height);
+  out->mask = cairo_pattern_create_for_surface(sub);
+  cairo_pattern_set_filter(out->mask, CAIRO_FILTER_NEAREST);
+  cairo_surface_destroy(sub);
+  out->x = left;
+  out->y = top;
+  return true;
+}
+
+cairo_surface_t* GlyphAtlas::Allocate(int width, int height, int* x, int* y) {
+  if (row_x_ + width > kPageSize) {
+    row_y_ += row_height_;
+    row_x_ = row_height_ = 0;
+  }
+  if (pages_.empty() || row_y_ + height > kPageSize) {
+    if (pages_.size() == kMaxPages)
+      Clear();
+    pages_.push_back(
+        cairo_image_surface_create(CAIRO_FORMAT_A8, kPageSize, kPageSize));
+    row_x_ = row_y_ = row_height_ = 0;
+  }
+  *x = row_x_;
+  *y = row_y_;
+  row_x_ += width + 1;
+  row_height_ = std::max(row_height_, height + 1);
+  return pages_.back();
+}
+
+}  // namespace nu
@@ -0,0 +1,85 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_GTK_GLYPH_ATLAS_H_
+#define NATIVEUI_GFX_GTK_GLYPH_ATLAS_H_
+
+#include <pango/pangocairo.h>
+
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace nu {
+
+// Cache rasterized glyphs as alpha masks in a few large surfaces, so drawing
+// the same glyphs again only composites the masks with current color.
+//
+// Glyphs are rasterized for each (font, scale), and are positioned on whole
+// device pixels.
+class GlyphAtlas {
+ public:
+  struct Glyph {
+    // The mask, null if the glyph has no ink.
+    cairo_pattern_t* mask = nullptr;
+    // Offset in device pixels from the glyph origin to the mask.
+    int x = 0;
+    int y = 0;
+  };
+
+  GlyphAtlas();
+  ~GlyphAtlas();
+
+  GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+  GlyphAtlas(const GlyphAtlas&) = delete;
+
+  // Draw |glyphs| of |font| with baseline origin at |x| and |y| in device
+  // pixels, the context must have identity matrix and the source set.
+  // Return false if the glyphs can not be drawn from atlas.
+  bool DrawGlyphs(cairo_t* context,
+                  PangoFont* font,
+                  PangoGlyphString* glyphs,
+                  double scale,
+                  double x,
+                  double y);
+
+  // Drop all cached glyphs.
+  void Clear();
+
+  size_t GetGlyphCount() const { return glyphs_.size(); }
+  size_t GetPageCount() const { return pages_.size(); }
+
+ private:
+  using Key = std::tuple<PangoFont*, double, PangoGlyph>;
+
+  // Return the cached glyph, rasterize it if not cached.
+  const Glyph* GetGlyph(PangoFont* font, double scale, PangoGlyph glyph);
+  bool Rasterize(cairo_scaled_font_t* scaled_font,
+                 double scale,
+                 PangoGlyph glyph,
+                 Glyph* out);
+  // Find space for a mask of |width| and |height| in pages.
+  cairo_surface_t* Allocate(int width, int height, int* x, int* y);
+
+  std::map<Key, Glyph> glyphs_;
+  // Fonts are referenced so their addresses stay unique in keys.
+  std::set<PangoFont*> fonts_;
+  // Fonts that can not be drawn as masks, like color fonts.
+  std::set<PangoFont*> unsupported_fonts_;
+
+  // Glyphs are packed into rows of the last page.
+  std::vector<cairo_surface_t*> pages_;
+  int row_x_ = 0;
+  int row_y_ = 0;
+  int row_height_ = 0;
+
+  // Used for measuring glyphs.
+  cairo_surface_t* scratch_surface_;
+  cairo_t* scratch_context_;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_GTK_GLYPH_ATLAS_H_
@@ -0,0 +1,127 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/gtk/hairline.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace nu {
+
+namespace {
+
+// Fast division by 255 that is exact for products of two 8-bit values.
+inline uint32_t Div255(uint32_t value) {
+  value += 128;
+  return (value + (value >> 8)) >> 8;
+}
+
+class HairlineWriter {
+ public:
+  HairlineWriter(uint8_t* pixels, int stride, const Rect& clip, Color color,
+                 float opacity)
+      : pixels_(pixels),
+        stride_(stride),
+        clip_(clip),
+        color_(color),
+        alpha_(color.a() * std::min(std::max(opacity, 0.f), 1.f)) {}
+
+  void DrawSegment(float x0, float y0, float x1, float y1, bool include_end) {
+    // Pixel centers are at half pixels.
+    x0 -= 0.5f;
+    y0 -= 0.5f;
+    x1 -= 0.5f;
+    y1 -= 0.5f;
+    bool steep = fabsf(y1 - y0) > fabsf(x1 - x0);
+    if (steep) {
+      std::swap(x0, y0);
+      std::swap(x1, y1);
+    }
+    int start = lroundf(x0);
+    int end = lroundf(x1);
+    int step = end >= start ? 1 : -1;
+    int last = include_end ? end + step : end;
+    // Only iterate the pixels inside clip on the major axis.
+    int min_major = steep ? clip_.y() : clip_.x();
+    int max_major = steep ? clip_.bottom() : clip_.right();
+    if (step > 0) {
+      start = std::max(start, min_major);
+      last = std::min(last, max_major);
+      if (start >= last)
+        return;
+    } else {
+      start = std::min(start, max_major - 1);
+      last = std::max(last, min_major - 1);
+      if (start <= last)
+        return;
+    }
+    float gradient = x1 == x0 ? 0 : (y1 - y0) / (x1 - x0);
+    for (int x = start; x != last; x += step) {
+      float y = y0 + gradient * (x - x0);
+      float floor_y = floorf(y);
+      float fraction = y - floor_y;
+      int iy = static_cast<int>(floor_y);
+      if (steep) {
+        Blend(iy, x, 1 - fraction);
+        Blend(iy + 1, x, fraction);
+      } else {
+        Blend(x, iy, 1 - fraction);
+        Blend(x, iy + 1, fraction);
+      }
+    }
+  }
+
+ private:
+  void Blend(int x, int y, float coverage) {
+    if (x < clip_.x() || x >= clip_.right() ||
+        y < clip_.y() || y >= clip_.bottom())
+      return;
+    uint32_t alpha = static_cast<uint32_t>(alpha_ * coverage + 0.5f);
+    if (alpha == 0)
+      return;
+    uint32_t* pixel = reinterpret_cast<uint32_t*>(pixels_ + y * stride_) + x;
+    uint32_t inverse = 255 - alpha;
+    uint32_t dest = *pixel;
+    uint32_t a = alpha + Div255(((dest >> 24) & 0xFF) * inverse);
+    uint32_t r = Div255(color_.r() * alpha + ((dest >> 16) & 0xFF) * inverse);
+    uint32_t g = Div255(color_.g() * alpha + ((dest >> 8) & 0xFF) * inverse);
+    uint32_t b = Div255(color_.b() * alpha + (dest & 0xFF) * inverse);
+    *pixel = (a << 24) | (r << 16) | (g << 8) | b;
+  }
+
+  uint8_t* pixels_;
+  int stride_;
+  Rect clip_;
+  Color color_;
+  float alpha_;
+};
+
+}  // namespace
+
+void DrawHairlines(uint8_t* pixels,
+                   int stride,
+                   const Rect& clip,
+                   const PointF* points,
+                   size_t count,
+                   Color color,
+                   float opacity) {
+  if (clip.IsEmpty() || color.transparent())
+    return;
+  HairlineWriter writer(pixels, stride, clip, color, opacity);
+  for (size_t i = 1; i < count; ++i) {
+    const PointF& p0 = points[i - 1];
+    const PointF& p1 = points[i];
+    // Skip segments that are entirely out of clip.
+    if (std::max(p0.x(), p1.x()) < clip.x() - 1 ||
+        std::min(p0.x(), p1.x()) > clip.right() + 1 ||
+        std::max(p0.y(), p1.y()) < clip.y() - 1 ||
+        std::min(p0.y(), p1.y()) > clip.bottom() + 1)
+      continue;
+    writer.DrawSegment(p0.x(), p0.y(), p1.x(), p1.y(), i == count - 1);
+  }
+}
+
+}  // namespace nu
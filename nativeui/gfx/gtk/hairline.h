@@ -0,0 +1,35 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_GTK_HAIRLINE_H_
+#define NATIVEUI_GFX_GTK_HAIRLINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nativeui/gfx/color.h"
+#include "nativeui/gfx/geometry/point_f.h"
+#include "nativeui/gfx/geometry/rect.h"
+
+namespace nu {
+
+// Draw antialiased lines of 1 pixel width connecting |points| on premultiplied
+// ARGB32 |pixels|, which is the memory layout of cairo image surfaces.
+//
+// The |points| are in pixels, and the drawing is clipped to |clip|. The alpha
+// of |color| is multiplied by |opacity|, which is used for thinner lines.
+//
+// Each pixel along the major axis is only drawn once for each segment, and the
+// end pixel is left to the next segment, so joints are not blended twice.
+void DrawHairlines(uint8_t* pixels,
+                   int stride,
+                   const Rect& clip,
+                   const PointF* points,
+                   size_t count,
+                   Color color,
+                   float opacity);
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_GTK_HAIRLINE_H_
@@ -5,9 +5,17 @@
 #include "nativeui/gfx/image.h"
 
 #include <gtk/gtk.h>
+#include <math.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
 
 #include "base/strings/string_number_conversions.h"
 #include "nativeui/gfx/geometry/size_conversions.h"
+#include "nativeui/gfx/gtk/image_kernels.h"
 
 namespace nu {
 
@@ -22,9 +30,71 @@ NativeImage CreateEmptyImage() {
   return GDK_PIXBUF_ANIMATION(image);
 }
 
-// Called to free the surface.
-void OnPixbufDestroy(guchar* data, gpointer surface) {
-  cairo_surface_destroy(static_cast<cairo_surface_t*>(surface));
+// Read at most this number of frames from animations.
+constexpr size_t kMaxFrames = 1000;
+
+// The shortest frame duration of transformed animations, GIF delays are in
+// 10ms units.
+constexpr int kMinFrameDelay = 10;
+
+// Create a new image by applying |transform| on all frames of |image|.
+NativeImage TransformFrames(
+    GdkPixbufAnimation* image,
+    const std::function<GdkPixbuf*(GdkPixbuf*)>& transform) {
+  std::vector<GdkPixbuf*> frames;
+  std::vector<int> delays;
+  if (gdk_pixbuf_animation_is_static_image(image)) {
+    frames.push_back(transform(gdk_pixbuf_animation_get_static_image(image)));
+    delays.push_back(-1);
+  } else {
+    // Walk through frames by advancing the time with frame delays. Loaders
+    // may reuse one pixbuf for all frames and frames may repeat, so instead
+    // of comparing pixbufs, stop on the last frame of the loop, which is
+    // reported as the currently loading frame for loaded animations.
+    GTimeVal time = {0, 0};
+    GdkPixbufAnimationIter* iter = gdk_pixbuf_animation_get_iter(image, &time);
+    while (frames.size() < kMaxFrames) {
+      int delay = gdk_pixbuf_animation_iter_get_delay_time(iter);
+      frames.push_back(transform(gdk_pixbuf_animation_iter_get_pixbuf(iter)));
+      delays.push_back(delay);
+      if (delay <= 0 ||
+          gdk_pixbuf_animation_iter_on_currently_loading_frame(iter))
+        break;
+      g_time_val_add(&time, delay * 1000);
+      gdk_pixbuf_animation_iter_advance(iter, &time);
+    }
+    g_object_unref(iter);
+  }
+  // GdkPixbufSimpleAnim only supports fixed frame rate, so use the greatest
+  // common divisor of delays as frame duration and repeat longer frames.
+  int unit = 0;
+  for (int delay : delays) {
+    if (delay > 0)
+      unit = std::gcd(unit, delay);
+  }
+  unit = std::max(unit, kMinFrameDelay);
+  int width = gdk_pixbuf_get_width(frames[0]);
+  int height = gdk_pixbuf_get_height(frames[0]);
+  GdkPixbufSimpleAnim* result = gdk_pixbuf_simple_anim_new(width, height,
+                                                           1000.f / unit);
+  gdk_pixbuf_simple_anim_set_loop(result, frames.size() > 1);
+  for (size_t i = 0; i < frames.size(); ++i) {
+    int repeat = std::max(static_cast<int>(lround(1.f * delays[i] / unit)), 1);
+    for (int j = 0; j < repeat; ++j)
+      gdk_pixbuf_simple_anim_add_frame(result, frames[i]);
+    g_object_unref(frames[i]);
+  }
+  return GDK_PIXBUF_ANIMATION(result);
+}
+
+// Pass the data written by gdk-pixbuf's encoders to Image::WriteFunc.
+gboolean OnEncodedChunk(const gchar* data,
+                        gsize size,
+                        GError** error,
+                        gpointer user_data) {
+  auto* write = static_cast<const Image::WriteFunc*>(user_data);
+  (*write)(Buffer::Wrap(data, size));
+  return TRUE;
 }
 
 }  // namespace
@@ -74,50 +144,44 @@ SizeF Image::GetSize() const {
 }
 
 Image* Image::Tint(Color color) const {
-  // Create surface to draw.
-  int width = gdk_pixbuf_animation_get_width(image_);
-  int height = gdk_pixbuf_animation_get_height(image_);
-  cairo_surface_t* surface = cairo_image_surface_create(
-      CAIRO_FORMAT_ARGB32, width, height);
-  cairo_t* context = cairo_create(surface);
-  // Draw image on the surface.
-  GdkPixbuf* pixbuf = gdk_pixbuf_animation_get_static_image(image_);
-  gdk_cairo_set_source_pixbuf(context, pixbuf, 0, 0);
-  cairo_paint(context);
-  // Apply tint color.
-  cairo_set_operator(context, CAIRO_OPERATOR_ATOP);
-  cairo_set_source_rgba(context, color.r() / 255., color.g() / 255.,
-                                 color.b() / 255., color.a() / 255.);
-  cairo_rectangle(context, 0, 0, width, height);
-  cairo_fill(context);
-  cairo_destroy(context);
-  // Save the surface to pixbuf.
-  GdkPixbuf* frame = gdk_pixbuf_new_from_data(
-      cairo_image_surface_get_data(surface), GDK_COLORSPACE_RGB, TRUE, 8,
-      width, height, cairo_image_surface_get_stride(surface),
-      // GdkPixbuf does not hold the data, we have to keep the surface alive
-      // until the pixbuf is destroyed.
-      OnPixbufDestroy, surface);
-  // Create new image.
-  GdkPixbufSimpleAnim* image = gdk_pixbuf_simple_anim_new(width, height, 1.f);
-  gdk_pixbuf_simple_anim_add_frame(image, frame);
-  g_object_unref(frame);
-  return new Image(GDK_PIXBUF_ANIMATION(image), scale_factor_);
+  return new Image(TransformFrames(image_, [&](GdkPixbuf* frame) {
+    // Add alpha channel and copy the frame.
+    GdkPixbuf* result = gdk_pixbuf_add_alpha(frame, false, 0, 0, 0);
+    int width = gdk_pixbuf_get_width(result);
+    int height = gdk_pixbuf_get_height(result);
+    int stride = gdk_pixbuf_get_rowstride(result);
+    guchar* pixels = gdk_pixbuf_get_pixels(result);
+    for (int y = 0; y < height; ++y)
+      TintPixels(pixels + y * stride, width, color);
+    return result;
+  }), scale_factor_);
 }
 
 Image* Image::Resize(SizeF new_size, float scale_factor) const {
   Size scaled_size = ToRoundedSize(ScaleSize(new_size, scale_factor));
-  GdkPixbuf* frame = gdk_pixbuf_scale_simple(
-      gdk_pixbuf_animation_get_static_image(image_),
-      scaled_size.width(),
-      scaled_size.height(),
-      GDK_INTERP_BILINEAR);
-  // Create new image.
-  GdkPixbufSimpleAnim* image = gdk_pixbuf_simple_anim_new(
-      scaled_size.width(), scaled_size.height(), 1.f);
-  gdk_pixbuf_simple_anim_add_frame(image, frame);
-  g_object_unref(frame);
-  return new Image(GDK_PIXBUF_ANIMATION(image), scale_factor);
+  int dest_width = std::max(scaled_size.width(), 1);
+  int dest_height = std::max(scaled_size.height(), 1);
+  return new Image(TransformFrames(image_, [&](GdkPixbuf* frame) {
+    // Resample in premultiplied alpha to avoid color of transparent pixels
+    // bleeding into neighbours.
+    GdkPixbuf* src = gdk_pixbuf_add_alpha(frame, false, 0, 0, 0);
+    int width = gdk_pixbuf_get_width(src);
+    int height = gdk_pixbuf_get_height(src);
+    int stride = gdk_pixbuf_get_rowstride(src);
+    guchar* pixels = gdk_pixbuf_get_pixels(src);
+    for (int y = 0; y < height; ++y)
+      PremultiplyPixels(pixels + y * stride, width);
+    GdkPixbuf* result = gdk_pixbuf_new(GDK_COLORSPACE_RGB, true, 8,
+                                       dest_width, dest_height);
+    int dest_stride = gdk_pixbuf_get_rowstride(result);
+    guchar* dest = gdk_pixbuf_get_pixels(result);
+    ResamplePixels(pixels, width, height, stride,
+                   dest, dest_width, dest_height, dest_stride);
+    for (int y = 0; y < dest_height; ++y)
+      UnpremultiplyPixels(dest + y * dest_stride, dest_width);
+    g_object_unref(src);
+    return result;
+  }), scale_factor);
 }
 
 Buffer Image::ToPNG() const {
@@ -141,6 +205,54 @@ Buffer Image::ToJPEG(int quality) const {
   return Buffer::TakeOver(buffer, size, g_free);
 }
 
+bool Image::PlatformEncode(const EncodeOptions& options,
+                           const WriteFunc& write) const {
+  const char* type;
+  std::vector<std::string> keys;
+  std::vector<std::string> values;
+  if (options.format == Format::JPEG) {
+    // The progressive option is not supported by gdk-pixbuf.
+    type = "jpeg";
+    keys.push_back("quality");
+    values.push_back(base::NumberToString(
+        std::max(0, std::min(options.quality, 100))));
+  } else {
+    type = "png";
+    if (options.compression >= 0) {
+      keys.push_back("compression");
+      values.push_back(base::NumberToString(std::min(options.compression, 9)));
+    }
+  }
+  std::vector<char*> c_keys;
+  std::vector<char*> c_values;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    c_keys.push_back(const_cast<char*>(keys[i].c_str()));
+    c_values.push_back(const_cast<char*>(values[i].c_str()));
+  }
+  c_keys.push_back(nullptr);
+  c_values.push_back(nullptr);
+  return gdk_pixbuf_save_to_callbackv(
+      gdk_pixbuf_animation_get_static_image(image_),
+      &OnEncodedChunk, const_cast<WriteFunc*>(&write), type,
+      c_keys.data(), c_values.data(), nullptr);
+}
+
+bool Image::PlatformReadPixels(const ReadPixelsCallback& callback) const {
+  GdkPixbuf* pixbuf = gdk_pixbuf_animation_get_static_image(image_);
+  if (gdk_pixbuf_get_n_channels(pixbuf) == 4)
+    g_object_ref(pixbuf);
+  else
+    pixbuf = gdk_pixbuf_add_alpha(pixbuf, false, 0, 0, 0);
+  if (!pixbuf)
+    return false;
+  callback(gdk_pixbuf_get_pixels(pixbuf),
+           gdk_pixbuf_get_width(pixbuf),
+           gdk_pixbuf_get_height(pixbuf),
+           gdk_pixbuf_get_rowstride(pixbuf));
+  g_object_unref(pixbuf);
+  return true;
+}
+
 bool Image::WriteToFile(const std::string& format,
                         const base::FilePath& target) {
   GdkPixbuf* pixbuf = gdk_pixbuf_animation_get_static_image(image_);
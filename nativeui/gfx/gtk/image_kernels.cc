@@ -0,0 +1,364 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/gtk/image_kernels.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace nu {
+
+namespace {
+
+// Divide |x| by 255 with rounding, |x| must not be larger than 255 * 255.
+inline uint32_t Div255(uint32_t x) {
+  x += 128;
+  return (x + (x >> 8)) >> 8;
+}
+
+#if defined(__SSE2__)
+
+inline __m128i Div255(__m128i x) {
+  x = _mm_add_epi16(x, _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// Operations on a pixel with 4 float channels.
+using Vec4 = __m128;
+
+inline Vec4 Zero() {
+  return _mm_setzero_ps();
+}
+
+inline Vec4 LoadPixel(const uint8_t* p) {
+  int32_t value;
+  memcpy(&value, p, 4);
+  const __m128i zero = _mm_setzero_si128();
+  __m128i v = _mm_cvtsi32_si128(value);
+  v = _mm_unpacklo_epi16(_mm_unpacklo_epi8(v, zero), zero);
+  return _mm_cvtepi32_ps(v);
+}
+
+inline void StorePixel(uint8_t* p, Vec4 v) {
+  __m128i i = _mm_cvtps_epi32(v);
+  i = _mm_packs_epi32(i, i);
+  i = _mm_packus_epi16(i, i);
+  int32_t value = _mm_cvtsi128_si32(i);
+  memcpy(p, &value, 4);
+}
+
+inline Vec4 LoadFloats(const float* p) {
+  return _mm_loadu_ps(p);
+}
+
+inline void StoreFloats(float* p, Vec4 v) {
+  _mm_storeu_ps(p, v);
+}
+
+inline Vec4 MulAdd(Vec4 acc, Vec4 v, float w) {
+  return _mm_add_ps(acc, _mm_mul_ps(v, _mm_set1_ps(w)));
+}
+
+#elif defined(__ARM_NEON)
+
+inline uint8x8_t Div255(uint16x8_t x) {
+  return vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8);
+}
+
+using Vec4 = float32x4_t;
+
+inline Vec4 Zero() {
+  return vdupq_n_f32(0);
+}
+
+inline Vec4 LoadPixel(const uint8_t* p) {
+  uint32_t value;
+  memcpy(&value, p, 4);
+  uint8x8_t v = vreinterpret_u8_u32(vdup_n_u32(value));
+  return vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(v))));
+}
+
+inline void StorePixel(uint8_t* p, Vec4 v) {
+  v = vaddq_f32(vmaxq_f32(v, vdupq_n_f32(0)), vdupq_n_f32(0.5f));
+  uint16x4_t s = vqmovn_u32(vcvtq_u32_f32(v));
+  uint8x8_t b = vqmovn_u16(vcombine_u16(s, s));
+  uint32_t value = vget_lane_u32(vreinterpret_u32_u8(b), 0);
+  memcpy(p, &value, 4);
+}
+
+inline Vec4 LoadFloats(const float* p) {
+  return vld1q_f32(p);
+}
+
+inline void StoreFloats(float* p, Vec4 v) {
+  vst1q_f32(p, v);
+}
+
+inline Vec4 MulAdd(Vec4 acc, Vec4 v, float w) {
+  return vmlaq_n_f32(acc, v, w);
+}
+
+#else
+
+struct Vec4 {
+  float v[4];
+};
+
+inline Vec4 Zero() {
+  return Vec4{{0, 0, 0, 0}};
+}
+
+inline Vec4 LoadPixel(const uint8_t* p) {
+  Vec4 v;
+  for (int c = 0; c < 4; ++c)
+    v.v[c] = p[c];
+  return v;
+}
+
+inline void StorePixel(uint8_t* p, Vec4 v) {
+  for (int c = 0; c < 4; ++c)
+    p[c] = static_cast<uint8_t>(std::min(std::max(v.v[c] + 0.5f, 0.f), 255.f));
+}
+
+inline Vec4 LoadFloats(const float* p) {
+  return Vec4{{p[0], p[1], p[2], p[3]}};
+}
+
+inline void StoreFloats(float* p, Vec4 v) {
+  memcpy(p, v.v, sizeof(v.v));
+}
+
+inline Vec4 MulAdd(Vec4 acc, Vec4 v, float w) {
+  for (int c = 0; c < 4; ++c)
+    acc.v[c] += v.v[c] * w;
+  return acc;
+}
+
+#endif
+
+// The weights of source pixels for each destination pixel.
+struct Filter {
+  // Max number of source pixels for each destination pixel.
+  int taps = 0;
+  std::vector<int> starts;
+  std::vector<int> counts;
+  std::vector<float> weights;
+};
+
+float Lanczos3(float x) {
+  if (x == 0)
+    return 1;
+  if (x <= -3 || x >= 3)
+    return 0;
+  float px = static_cast<float>(M_PI) * x;
+  return 3 * sinf(px) * sinf(px / 3) / (px * px);
+}
+
+Filter CreateFilter(int src_size, int dest_size) {
+  float scale = static_cast<float>(src_size) / dest_size;
+  // Box filter averages the covered source pixels, which is fast and has no
+  // aliasing when shrinking a lot.
+  bool box = scale >= 2;
+  // The Lanczos filter is stretched when shrinking to cover all pixels.
+  float stretch = std::max(scale, 1.f);
+  float support = box ? scale / 2 : 3 * stretch;
+  Filter filter;
+  filter.taps = static_cast<int>(ceilf(support * 2)) + 2;
+  filter.starts.resize(dest_size);
+  filter.counts.resize(dest_size);
+  filter.weights.resize(dest_size * filter.taps);
+  for (int i = 0; i < dest_size; ++i) {
+    float center = (i + 0.5f) * scale;
+    int start = std::max(0, static_cast<int>(floorf(center - support)));
+    int end = std::min(src_size, static_cast<int>(ceilf(center + support)));
+    int count = std::min(end - start, filter.taps);
+    float* weights = &filter.weights[i * filter.taps];
+    float sum = 0;
+    for (int j = 0; j < count; ++j) {
+      float left = static_cast<float>(start + j);
+      float weight;
+      if (box) {
+        weight = std::max(0.f, std::min(left + 1, center + support) -
+                               std::max(left, center - support));
+      } else {
+        weight = Lanczos3((left + 0.5f - center) / stretch);
+      }
+      weights[j] = weight;
+      sum += weight;
+    }
+    // Pixels out of the edges are dropped, so normalize the rest.
+    if (sum != 0) {
+      for (int j = 0; j < count; ++j)
+        weights[j] /= sum;
+    }
+    filter.starts[i] = start;
+    filter.counts[i] = count;
+  }
+  return filter;
+}
+
+}  // namespace
+
+void TintPixels(uint8_t* pixels, size_t count, Color color) {
+  uint32_t inverse = 255 - color.a();
+  uint32_t r = color.r() * color.a();
+  uint32_t g = color.g() * color.a();
+  uint32_t b = color.b() * color.a();
+  size_t i = 0;
+#if defined(__SSE2__)
+  // The alpha is multiplied by 255 and added by 0, so it does not change.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i mul = _mm_setr_epi16(inverse, inverse, inverse, 255,
+                                     inverse, inverse, inverse, 255);
+  const __m128i add = _mm_setr_epi16(static_cast<int16_t>(r),
+                                     static_cast<int16_t>(g),
+                                     static_cast<int16_t>(b), 0,
+                                     static_cast<int16_t>(r),
+                                     static_cast<int16_t>(g),
+                                     static_cast<int16_t>(b), 0);
+  for (; i + 4 <= count; i += 4) {
+    __m128i* p = reinterpret_cast<__m128i*>(pixels + i * 4);
+    __m128i v = _mm_loadu_si128(p);
+    __m128i lo = _mm_unpacklo_epi8(v, zero);
+    __m128i hi = _mm_unpackhi_epi8(v, zero);
+    lo = Div255(_mm_add_epi16(_mm_mullo_epi16(lo, mul), add));
+    hi = Div255(_mm_add_epi16(_mm_mullo_epi16(hi, mul), add));
+    _mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+  }
+#elif defined(__ARM_NEON)
+  const uint8x8_t mul = vdup_n_u8(inverse);
+  for (; i + 8 <= count; i += 8) {
+    uint8_t* p = pixels + i * 4;
+    uint8x8x4_t v = vld4_u8(p);
+    v.val[0] = Div255(vmlal_u8(vdupq_n_u16(r), v.val[0], mul));
+    v.val[1] = Div255(vmlal_u8(vdupq_n_u16(g), v.val[1], mul));
+    v.val[2] = Div255(vmlal_u8(vdupq_n_u16(b), v.val[2], mul));
+    vst4_u8(p, v);
+  }
+#endif
+  for (; i < count; ++i) {
+    uint8_t* p = pixels + i * 4;
+    p[0] = Div255(p[0] * inverse + r);
+    p[1] = Div255(p[1] * inverse + g);
+    p[2] = Div255(p[2] * inverse + b);
+  }
+}
+
+void PremultiplyPixels(uint8_t* pixels, size_t count) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  // Broadcast alpha to all channels, and multiply alpha itself by 255.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i alpha_mask = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+  const __m128i alpha_one = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+  auto premultiply = [&](__m128i v) {
+    __m128i a = _mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3));
+    a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+    a = _mm_or_si128(_mm_andnot_si128(alpha_mask, a), alpha_one);
+    return Div255(_mm_mullo_epi16(v, a));
+  };
+  for (; i + 4 <= count; i += 4) {
+    __m128i* p = reinterpret_cast<__m128i*>(pixels + i * 4);
+    __m128i v = _mm_loadu_si128(p);
+    __m128i lo = premultiply(_mm_unpacklo_epi8(v, zero));
+    __m128i hi = premultiply(_mm_unpackhi_epi8(v, zero));
+    _mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 8 <= count; i += 8) {
+    uint8_t* p = pixels + i * 4;
+    uint8x8x4_t v = vld4_u8(p);
+    v.val[0] = Div255(vmull_u8(v.val[0], v.val[3]));
+    v.val[1] = Div255(vmull_u8(v.val[1], v.val[3]));
+    v.val[2] = Div255(vmull_u8(v.val[2], v.val[3]));
+    vst4_u8(p, v);
+  }
+#endif
+  for (; i < count; ++i) {
+    uint8_t* p = pixels + i * 4;
+    p[0] = Div255(p[0] * p[3]);
+    p[1] = Div255(p[1] * p[3]);
+    p[2] = Div255(p[2] * p[3]);
+  }
+}
+
+void UnpremultiplyPixels(uint8_t* pixels, size_t count) {
+  // Division has no SIMD instruction, use a table of 255 * 65536 / alpha so
+  // c * 255 / alpha becomes (c * table[alpha] + 32768) >> 16.
+  uint32_t table[256];
+  table[0] = 0;
+  for (uint32_t a = 1; a < 256; ++a)
+    table[a] = ((255u << 16) + a / 2) / a;
+  for (size_t i = 0; i < count; ++i) {
+    uint8_t* p = pixels + i * 4;
+    uint32_t a = p[3];
+    if (a == 255)
+      continue;
+    uint32_t scale = table[a];
+    p[0] = std::min<uint32_t>(255, (p[0] * scale + 32768) >> 16);
+    p[1] = std::min<uint32_t>(255, (p[1] * scale + 32768) >> 16);
+    p[2] = std::min<uint32_t>(255, (p[2] * scale + 32768) >> 16);
+  }
+}
+
+void ResamplePixels(const uint8_t* src,
+                    int src_width,
+                    int src_height,
+                    int src_stride,
+                    uint8_t* dest,
+                    int dest_width,
+                    int dest_height,
+                    int dest_stride) {
+  if (src_width <= 0 || src_height <= 0 || dest_width <= 0 || dest_height <= 0)
+    return;
+  Filter horizontal = CreateFilter(src_width, dest_width);
+  Filter vertical = CreateFilter(src_height, dest_height);
+
+  // Resample rows into floats first, which keeps the precision and negative
+  // lobes of Lanczos filter for the vertical pass.
+  std::vector<float> rows(static_cast<size_t>(dest_width) * src_height * 4);
+  for (int y = 0; y < src_height; ++y) {
+    const uint8_t* src_row = src + static_cast<size_t>(y) * src_stride;
+    float* row = &rows[static_cast<size_t>(y) * dest_width * 4];
+    for (int x = 0; x < dest_width; ++x) {
+      const float* weights = &horizontal.weights[x * horizontal.taps];
+      const uint8_t* p = src_row + horizontal.starts[x] * 4;
+      Vec4 acc = Zero();
+      for (int j = 0; j < horizontal.counts[x]; ++j)
+        acc = MulAdd(acc, LoadPixel(p + j * 4), weights[j]);
+      StoreFloats(row + x * 4, acc);
+    }
+  }
+
+  // Accumulate whole rows for each destination row, which reads memory
+  // sequentially.
+  std::vector<float> acc_row(static_cast<size_t>(dest_width) * 4);
+  for (int y = 0; y < dest_height; ++y) {
+    std::fill(acc_row.begin(), acc_row.end(), 0.f);
+    const float* weights = &vertical.weights[y * vertical.taps];
+    for (int j = 0; j < vertical.counts[y]; ++j) {
+      const float* row =
+          &rows[static_cast<size_t>(vertical.starts[y] + j) * dest_width * 4];
+      float weight = weights[j];
+      for (int x = 0; x < dest_width * 4; x += 4) {
+        StoreFloats(&acc_row[x], MulAdd(LoadFloats(&acc_row[x]),
+                                        LoadFloats(row + x), weight));
+      }
+    }
+    uint8_t* dest_row = dest + static_cast<size_t>(y) * dest_stride;
+    for (int x = 0; x < dest_width; ++x)
+      StorePixel(dest_row + x * 4, LoadFloats(&acc_row[x * 4]));
+  }
+}
+
+}  // namespace nu
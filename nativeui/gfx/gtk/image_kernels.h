@@ -0,0 +1,41 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_GTK_IMAGE_KERNELS_H_
+#define NATIVEUI_GFX_GTK_IMAGE_KERNELS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nativeui/gfx/color.h"
+
+namespace nu {
+
+// Kernels working on rows of 8-bit RGBA pixels, which is the memory layout of
+// GdkPixbuf with alpha channel. They use SSE2 or NEON when available.
+
+// Blend |color| over the unpremultiplied |pixels| while keeping their alpha,
+// which has the same result with drawing |color| with the ATOP operator.
+void TintPixels(uint8_t* pixels, size_t count, Color color);
+
+// Convert |pixels| between unpremultiplied and premultiplied alpha.
+void PremultiplyPixels(uint8_t* pixels, size_t count);
+void UnpremultiplyPixels(uint8_t* pixels, size_t count);
+
+// Resample premultiplied pixels of |src| into |dest|.
+//
+// For each direction, box filter is used when shrinking to half or smaller,
+// otherwise the Lanczos filter with 3 lobes is used.
+void ResamplePixels(const uint8_t* src,
+                    int src_width,
+                    int src_height,
+                    int src_stride,
+                    uint8_t* dest,
+                    int dest_width,
+                    int dest_height,
+                    int dest_stride);
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_GTK_IMAGE_KERNELS_H_
@@ -10,12 +10,18 @@
 #include <gtk/gtk.h>
 #include <math.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "nativeui/gfx/attributed_text.h"
 #include "nativeui/gfx/canvas.h"
 #include "nativeui/gfx/font.h"
+#include "nativeui/gfx/geometry/rect_conversions.h"
+#include "nativeui/gfx/gtk/glyph_atlas.h"
+#include "nativeui/gfx/gtk/hairline.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
+#include "nativeui/state.h"
 
 namespace nu {
 
@@ -50,6 +56,9 @@ cairo_operator_t g_blend_modes[static_cast<size_t>(BlendMode::Size)] = {
   CAIRO_OPERATOR_XOR,
 };
 
+// Larger coordinates are left to cairo, which handles overflows.
+constexpr double kMaxHairlineCoordinate = 1 << 20;
+
 }  // namespace
 
 PainterGtk::PainterGtk(cairo_t* context, SizeF size)
@@ -198,6 +207,74 @@ void PainterGtk::DrawPath() {
   cairo_stroke(context_);
 }
 
+void PainterGtk::FillPath(const Path* path) {
+  cairo_new_path(context_);
+  cairo_append_path(context_, path->GetNative());
+  SetSourceColor(false);
+  cairo_fill(context_);
+}
+
+void PainterGtk::StrokePath(const Path* path) {
+  cairo_new_path(context_);
+  cairo_append_path(context_, path->GetNative());
+  SetSourceColor(true);
+  cairo_stroke(context_);
+}
+
+void PainterGtk::FillRects(const Buffer& rects, const Buffer& colors) {
+  RectF clip = GetClipExtents();
+  FillByColors(GetBatchSize(rects, 4, colors), colors, [&](size_t i) {
+    float r[4];
+    ReadBatchItem(rects, i, 4, r);
+    if (clip.Intersects(RectF(r[0], r[1], r[2], r[3])))
+      cairo_rectangle(context_, r[0], r[1], r[2], r[3]);
+  });
+}
+
+void PainterGtk::StrokePolyline(const Buffer& points) {
+  size_t count = GetBatchSize(points, 2, Buffer());
+  cairo_new_path(context_);
+  if (count < 2 || DrawHairlinePolyline(points, count))
+    return;
+  for (size_t i = 0; i < count; ++i) {
+    float p[2];
+    ReadBatchItem(points, i, 2, p);
+    if (i == 0)
+      cairo_move_to(context_, p[0], p[1]);
+    else
+      cairo_line_to(context_, p[0], p[1]);
+  }
+  SetSourceColor(true);
+  cairo_stroke(context_);
+}
+
+void PainterGtk::DrawPoints(const Buffer& points,
+                            float diameter,
+                            const Buffer& colors) {
+  double radius = diameter / 2.;
+  // Small circles look the same with squares, which are faster to fill.
+  double dx = diameter, dy = diameter;
+  cairo_user_to_device_distance(context_, &dx, &dy);
+  double sx, sy;
+  cairo_surface_get_device_scale(cairo_get_group_target(context_), &sx, &sy);
+  bool use_squares = std::max(fabs(dx * sx), fabs(dy * sy)) <= 2;
+  RectF clip = GetClipExtents();
+  clip.Inset(-radius, -radius);
+  FillByColors(GetBatchSize(points, 2, colors), colors, [&](size_t i) {
+    float p[2];
+    ReadBatchItem(points, i, 2, p);
+    if (!clip.Contains(p[0], p[1]))
+      return;
+    if (use_squares) {
+      cairo_rectangle(context_, p[0] - radius, p[1] - radius,
+                      diameter, diameter);
+    } else {
+      cairo_new_sub_path(context_);
+      cairo_arc(context_, p[0], p[1], radius, 0, 2 * M_PI);
+    }
+  });
+}
+
 void PainterGtk::DrawImage(const Image* image, const RectF& rect) {
   DrawImageFromRect(image, RectF(image->GetSize()), rect);
 }
@@ -257,6 +334,7 @@ void PainterGtk::DrawAttributedText(scoped_refptr<AttributedText> text,
 
   // Vertical alignment.
   RectF bounds = text->GetBoundsFor(rect.size());
+  text->SetLayoutSize(rect.size());
   RectF target = rect;
   TextAlign valign = text->GetFormat().valign;
   if (valign == TextAlign::Center)
@@ -267,18 +345,214 @@ void PainterGtk::DrawAttributedText(scoped_refptr<AttributedText> text,
 
   // Draw.
   PangoLayout* layout = text->GetNative();
-  pango_cairo_show_layout(context_, layout);
+  if (!states_.top().use_glyph_atlas ||
+      !DrawLayoutFromGlyphAtlas(layout, target.origin()))
+    pango_cairo_show_layout(context_, layout);
   cairo_restore(context_);
 }
 
+std::vector<RectF> PainterGtk::GetDirtyRects() {
+  std::vector<RectF> rects;
+  cairo_rectangle_list_t* list = cairo_copy_clip_rectangle_list(context_);
+  if (list->status == CAIRO_STATUS_SUCCESS) {
+    for (int i = 0; i < list->num_rectangles; ++i) {
+      const cairo_rectangle_t& rect = list->rectangles[i];
+      rects.emplace_back(rect.x, rect.y, rect.width, rect.height);
+    }
+  } else {
+    // The clip is not representable as rectangles, i.e. there is no clip or
+    // it is transformed by rotation.
+    rects.push_back(GetClipExtents());
+  }
+  cairo_rectangle_list_destroy(list);
+  return rects;
+}
+
+bool PainterGtk::IsRectDirty(const RectF& rect) {
+  // Most rects are rejected by the extents without copying the clip.
+  if (!GetClipExtents().Intersects(rect))
+    return false;
+  return Painter::IsRectDirty(rect);
+}
+
+void PainterGtk::SetUseGlyphAtlas(bool use) {
+  states_.top().use_glyph_atlas = use;
+}
+
 void PainterGtk::Initialize() {
   // Initial state.
-  states_.push({Color(), Color()});
+  states_.push({Color(), Color(), false});
+}
+
+bool PainterGtk::DrawLayoutFromGlyphAtlas(PangoLayout* layout,
+                                          const PointF& origin) {
+  // Glyphs are rasterized for scaling, but not for rotation or skew.
+  cairo_matrix_t matrix;
+  cairo_get_matrix(context_, &matrix);
+  if (matrix.xy != 0 || matrix.yx != 0 || matrix.xx != matrix.yy ||
+      matrix.xx <= 0)
+    return false;
+  double sx = 1, sy = 1;
+  cairo_surface_get_device_scale(cairo_get_target(context_), &sx, &sy);
+  if (sx != sy)
+    return false;
+  double scale = matrix.xx * sx;
+
+  GlyphAtlas* atlas = State::GetCurrent()->GetGlyphAtlas();
+  cairo_save(context_);
+  // Masks are positioned in device pixels.
+  cairo_identity_matrix(context_);
+  // Runs without colors are drawn with current source.
+  cairo_pattern_t* source = cairo_pattern_reference(cairo_get_source(context_));
+  PangoLayoutIter* iter = pango_layout_get_iter(layout);
+  do {
+    PangoLayoutRun* run = pango_layout_iter_get_run_readonly(iter);
+    if (!run)  // end of line
+      continue;
+    PangoRectangle logical;
+    pango_layout_iter_get_run_extents(iter, nullptr, &logical);
+    double x = origin.x() + pango_units_to_double(logical.x);
+    double y = origin.y() +
+               pango_units_to_double(pango_layout_iter_get_baseline(iter));
+    SetRunColor(run, source);
+    double device_x = x, device_y = y;
+    cairo_matrix_transform_point(&matrix, &device_x, &device_y);
+    if (!atlas->DrawGlyphs(context_, run->item->analysis.font, run->glyphs,
+                           scale, device_x * sx, device_y * sy)) {
+      // Fallback to drawing directly.
+      cairo_set_matrix(context_, &matrix);
+      cairo_move_to(context_, x, y);
+      pango_cairo_show_glyph_string(context_, run->item->analysis.font,
+                                    run->glyphs);
+      cairo_identity_matrix(context_);
+    }
+  } while (pango_layout_iter_next_run(iter));
+  pango_layout_iter_free(iter);
+  cairo_pattern_destroy(source);
+  cairo_restore(context_);
+  return true;
+}
+
+void PainterGtk::SetRunColor(PangoLayoutRun* run, cairo_pattern_t* source) {
+  for (GSList* l = run->item->analysis.extra_attrs; l; l = l->next) {
+    auto* attr = static_cast<PangoAttribute*>(l->data);
+    if (attr->klass->type == PANGO_ATTR_FOREGROUND) {
+      const PangoColor& color = reinterpret_cast<PangoAttrColor*>(attr)->color;
+      cairo_set_source_rgb(context_, color.red / 65535., color.green / 65535.,
+                           color.blue / 65535.);
+      return;
+    }
+  }
+  cairo_set_source(context_, source);
+}
+
+template<typename T>
+void PainterGtk::FillByColors(size_t count,
+                              const Buffer& colors,
+                              const T& add_item) {
+  cairo_new_path(context_);
+  if (colors.size() == 0) {
+    for (size_t i = 0; i < count; ++i)
+      add_item(i);
+    SetSourceColor(false);
+    cairo_fill(context_);
+    return;
+  }
+  // Source color is changed for each group, and restored at last.
+  Save();
+  Color color;
+  for (size_t i = 0; i < count; ++i) {
+    Color item_color = ReadBatchColor(colors, i);
+    if (i > 0 && item_color != color) {
+      SetSourceColor(color);
+      cairo_fill(context_);
+    }
+    color = item_color;
+    add_item(i);
+  }
+  if (count > 0) {
+    SetSourceColor(color);
+    cairo_fill(context_);
+  }
+  Restore();
+}
+
+bool PainterGtk::DrawHairlinePolyline(const Buffer& points, size_t count) {
+  cairo_surface_t* target = cairo_get_group_target(context_);
+  if (cairo_surface_get_type(target) != CAIRO_SURFACE_TYPE_IMAGE ||
+      cairo_image_surface_get_format(target) != CAIRO_FORMAT_ARGB32 ||
+      cairo_get_operator(context_) != CAIRO_OPERATOR_OVER)
+    return false;
+  // Only translation and scaling are supported.
+  cairo_matrix_t matrix;
+  cairo_get_matrix(context_, &matrix);
+  if (matrix.xy != 0 || matrix.yx != 0)
+    return false;
+  double sx, sy, ox, oy;
+  cairo_surface_get_device_scale(target, &sx, &sy);
+  cairo_surface_get_device_offset(target, &ox, &oy);
+  cairo_matrix_t device;
+  cairo_matrix_init(&device, sx, 0, 0, sy, ox, oy);
+  cairo_matrix_multiply(&matrix, &matrix, &device);
+  double width = cairo_get_line_width(context_) *
+                 std::max(fabs(matrix.xx), fabs(matrix.yy));
+  if (width > 1)
+    return false;
+
+  // The clip must be a rectangle, it is intersected with the surface.
+  cairo_rectangle_list_t* list = cairo_copy_clip_rectangle_list(context_);
+  bool supported = list->status == CAIRO_STATUS_SUCCESS &&
+                   list->num_rectangles <= 1;
+  Rect clip;
+  if (supported && list->num_rectangles == 1) {
+    const cairo_rectangle_t& r = list->rectangles[0];
+    double x1 = r.x, y1 = r.y;
+    double x2 = r.x + r.width, y2 = r.y + r.height;
+    cairo_matrix_transform_point(&matrix, &x1, &y1);
+    cairo_matrix_transform_point(&matrix, &x2, &y2);
+    clip = ToEnclosedRect(RectF(std::min(x1, x2), std::min(y1, y2),
+                                fabs(x2 - x1), fabs(y2 - y1)));
+    clip.Intersect(Rect(0, 0,
+                        cairo_image_surface_get_width(target),
+                        cairo_image_surface_get_height(target)));
+  }
+  cairo_rectangle_list_destroy(list);
+  if (!supported)
+    return false;
+
+  std::vector<PointF> pixels(count);
+  for (size_t i = 0; i < count; ++i) {
+    float p[2];
+    ReadBatchItem(points, i, 2, p);
+    double x = p[0], y = p[1];
+    cairo_matrix_transform_point(&matrix, &x, &y);
+    if (!(fabs(x) < kMaxHairlineCoordinate &&
+          fabs(y) < kMaxHairlineCoordinate))
+      return false;
+    pixels[i] = PointF(x, y);
+  }
+
+  cairo_surface_flush(target);
+  DrawHairlines(cairo_image_surface_get_data(target),
+                cairo_image_surface_get_stride(target),
+                clip, pixels.data(), count,
+                states_.top().stroke_color, width);
+  cairo_surface_mark_dirty(target);
+  return true;
+}
+
+RectF PainterGtk::GetClipExtents() {
+  double x1, y1, x2, y2;
+  cairo_clip_extents(context_, &x1, &y1, &x2, &y2);
+  return RectF(x1, y1, x2 - x1, y2 - y1);
 }
 
 void PainterGtk::SetSourceColor(bool stroke) {
-  Color color = stroke ? states_.top().stroke_color
-                       : states_.top().fill_color;
+  SetSourceColor(stroke ? states_.top().stroke_color
+                        : states_.top().fill_color);
+}
+
+void PainterGtk::SetSourceColor(Color color) {
   cairo_set_source_rgba(context_, color.r() / 255., color.g() / 255.,
                                   color.b() / 255., color.a() / 255.);
 }
@@ -5,8 +5,11 @@
 #ifndef NATIVEUI_GFX_GTK_PAINTER_GTK_H_
 #define NATIVEUI_GFX_GTK_PAINTER_GTK_H_
 
+#include <pango/pango.h>
+
 #include <stack>
 #include <string>
+#include <vector>
 
 #include "nativeui/gfx/painter.h"
 
@@ -49,6 +52,13 @@ class PainterGtk : public Painter {
   void StrokeRect(const RectF& rect) override;
   void FillRect(const RectF& rect) override;
   void DrawPath() override;
+  void FillPath(const Path* path) override;
+  void StrokePath(const Path* path) override;
+  void FillRects(const Buffer& rects, const Buffer& colors) override;
+  void StrokePolyline(const Buffer& points) override;
+  void DrawPoints(const Buffer& points,
+                  float diameter,
+                  const Buffer& colors) override;
   void DrawImage(const Image* image, const RectF& rect) override;
   void DrawImageFromRect(const Image* image, const RectF& src,
                          const RectF& dest) override;
@@ -57,19 +67,43 @@ class PainterGtk : public Painter {
                           const RectF& dest) override;
   void DrawAttributedText(scoped_refptr<AttributedText> text,
                           const RectF& rect) override;
+  std::vector<RectF> GetDirtyRects() override;
+  bool IsRectDirty(const RectF& rect) override;
+  void SetUseGlyphAtlas(bool use) override;
 
  private:
   // Common initailization used by constructors.
   void Initialize();
 
+  // Draw |layout| at |origin| with glyphs from atlas, return false if current
+  // transform is not supported.
+  bool DrawLayoutFromGlyphAtlas(PangoLayout* layout, const PointF& origin);
+
+  // Add items to path with |add_item| and fill them grouped by colors.
+  template<typename T>
+  void FillByColors(size_t count, const Buffer& colors, const T& add_item);
+
+  // Draw hairline by writing pixels directly, return false if the target or
+  // current states are not supported.
+  bool DrawHairlinePolyline(const Buffer& points, size_t count);
+
+  // Return the bounds of current clip in current coordinates.
+  RectF GetClipExtents();
+
   // Set source color from stroke or fill color.
   void SetSourceColor(bool stroke);
+  void SetSourceColor(Color color);
+
+  // Set source color from the foreground attribute of |run|, or to |source|
+  // when it does not have one.
+  void SetRunColor(PangoLayoutRun* run, cairo_pattern_t* source);
 
   // Cairo does not distinguish between stroke color and fill color, we have to
   // implement our own.
   struct PainterState {
     Color stroke_color;
     Color fill_color;
+    bool use_glyph_atlas;
   };
   std::stack<PainterState> states_;
 
@@ -0,0 +1,82 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#include <cairo.h>
+
+namespace nu {
+
+NativePath Path::PlatformCreate() const {
+  // The cairo_path_t is filled directly, which saves the cost of creating a
+  // context and recording the path in it.
+  int count = 0;
+  for (size_t i = 0; i < data_.size();) {
+    switch (static_cast<Command>(data_[i])) {
+      case Command::MoveTo:
+      case Command::LineTo:
+        count += 2;
+        i += 3;
+        break;
+      case Command::BezierCurveTo:
+        count += 4;
+        i += 7;
+        break;
+      default:
+        count += 1;
+        i += 1;
+        break;
+    }
+  }
+
+  cairo_path_t* path = new cairo_path_t;
+  path->status = CAIRO_STATUS_SUCCESS;
+  path->data = new cairo_path_data_t[count];
+  path->num_data = count;
+  cairo_path_data_t* d = path->data;
+  auto add_header = [&d](cairo_path_data_type_t type, int length) {
+    d->header.type = type;
+    d->header.length = length;
+    ++d;
+  };
+  auto add_points = [&d](const float* f, int count) {
+    for (int j = 0; j < count; ++j, ++d) {
+      d->point.x = f[j * 2];
+      d->point.y = f[j * 2 + 1];
+    }
+  };
+  for (size_t i = 0; i < data_.size();) {
+    const float* f = data_.data() + i + 1;
+    switch (static_cast<Command>(data_[i])) {
+      case Command::MoveTo:
+        add_header(CAIRO_PATH_MOVE_TO, 2);
+        add_points(f, 1);
+        i += 3;
+        break;
+      case Command::LineTo:
+        add_header(CAIRO_PATH_LINE_TO, 2);
+        add_points(f, 1);
+        i += 3;
+        break;
+      case Command::BezierCurveTo:
+        add_header(CAIRO_PATH_CURVE_TO, 4);
+        add_points(f, 3);
+        i += 7;
+        break;
+      default:
+        add_header(CAIRO_PATH_CLOSE_PATH, 1);
+        i += 1;
+        break;
+    }
+  }
+  return path;
+}
+
+// static
+void Path::PlatformDestroy(NativePath path) {
+  delete[] path->data;
+  delete path;
+}
+
+}  // namespace nu
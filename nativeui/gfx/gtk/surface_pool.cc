@@ -0,0 +1,191 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/gtk/surface_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <iterator>
+
+#include "nativeui/state.h"
+
+namespace nu {
+
+namespace {
+
+constexpr size_t kDefaultMemoryLimit = 32 * 1024 * 1024;
+constexpr size_t kMinBucketSize = 4 * 1024;
+
+// The pool is cleared if not used in this period.
+constexpr int kTrimDelayMs = 10 * 1000;
+
+// Key of the Block attached to surfaces.
+cairo_user_data_key_t kBlockKey;
+
+size_t GetBucketSize(size_t size) {
+  if (size <= kMinBucketSize)
+    return kMinBucketSize;
+  size_t power = kMinBucketSize;
+  while (power * 2 < size)
+    power *= 2;
+  size_t step = power / 4;
+  return (size + step - 1) / step * step;
+}
+
+}  // namespace
+
+SurfacePool::SurfacePool() : memory_limit_(kDefaultMemoryLimit) {}
+
+SurfacePool::~SurfacePool() {
+  if (trim_timer_)
+    MessageLoop::ClearTimeout(trim_timer_);
+  Clear();
+}
+
+cairo_surface_t* SurfacePool::CreateSurface(int width,
+                                            int height,
+                                            float scale_factor) {
+  size_t size = static_cast<size_t>(
+      cairo_format_stride_for_width(CAIRO_FORMAT_ARGB32, width)) * height;
+  Block* block = new Block;
+  block->data = Acquire(size, &block->capacity);
+  if (!block->data) {
+    // Let cairo allocate the memory and report the failure in the surface.
+    delete block;
+    cairo_surface_t* surface =
+        cairo_image_surface_create(CAIRO_FORMAT_ARGB32, width, height);
+    cairo_surface_set_device_scale(surface, scale_factor, scale_factor);
+    return surface;
+  }
+  memset(block->data, 0, size);
+  return CreateSurfaceForBlock(block, width, height, scale_factor);
+}
+
+cairo_surface_t* SurfacePool::ResizeSurface(cairo_surface_t* surface,
+                                            int width,
+                                            int height,
+                                            float scale_factor) {
+  size_t size = static_cast<size_t>(
+      cairo_format_stride_for_width(CAIRO_FORMAT_ARGB32, width)) * height;
+  auto* block = static_cast<Block*>(
+      cairo_surface_get_user_data(surface, &kBlockKey));
+  // Memory of surfaces much larger than needed is better used by others.
+  if (!block || !block->data ||
+      cairo_surface_get_reference_count(surface) != 1 ||
+      size > block->capacity || size < block->capacity / 4) {
+    cairo_surface_destroy(surface);
+    return CreateSurface(width, height, scale_factor);
+  }
+  // Move the memory to the new surface.
+  Block* moved = new Block(*block);
+  block->data = nullptr;
+  cairo_surface_destroy(surface);
+  stats_.reuses++;
+  memset(moved->data, 0, size);
+  return CreateSurfaceForBlock(moved, width, height, scale_factor);
+}
+
+void SurfacePool::Clear() {
+  Trim(0);
+}
+
+void SurfacePool::SetMemoryLimit(size_t limit) {
+  memory_limit_ = limit;
+  Trim(limit);
+}
+
+// static
+void SurfacePool::OnSurfaceDestroyed(void* user_data) {
+  auto* block = static_cast<Block*>(user_data);
+  if (block->data) {
+    // The state is unset when exiting.
+    State* state = State::GetCurrent();
+    if (state)
+      state->GetSurfacePool()->Release(block->data, block->capacity);
+    else
+      free(block->data);
+  }
+  delete block;
+}
+
+cairo_surface_t* SurfacePool::CreateSurfaceForBlock(Block* block,
+                                                    int width,
+                                                    int height,
+                                                    float scale_factor) {
+  cairo_surface_t* surface = cairo_image_surface_create_for_data(
+      block->data, CAIRO_FORMAT_ARGB32, width, height,
+      cairo_format_stride_for_width(CAIRO_FORMAT_ARGB32, width));
+  if (cairo_surface_set_user_data(surface, &kBlockKey, block,
+                                  &OnSurfaceDestroyed) !=
+      CAIRO_STATUS_SUCCESS) {
+    // Fallback to a surface that owns its memory.
+    cairo_surface_destroy(surface);
+    OnSurfaceDestroyed(block);
+    surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, width, height);
+  }
+  cairo_surface_set_device_scale(surface, scale_factor, scale_factor);
+  return surface;
+}
+
+uint8_t* SurfacePool::Acquire(size_t size, size_t* capacity) {
+  used_since_trim_ = true;
+  *capacity = GetBucketSize(size);
+  // Prefer the most recently released memory, which is likely still cached.
+  for (auto it = blocks_.rbegin(); it != blocks_.rend(); ++it) {
+    if (it->capacity == *capacity) {
+      uint8_t* data = it->data;
+      blocks_.erase(std::next(it).base());
+      stats_.pooled_bytes -= *capacity;
+      stats_.hits++;
+      return data;
+    }
+  }
+  stats_.misses++;
+  auto* data = static_cast<uint8_t*>(malloc(*capacity));
+  if (!data && !blocks_.empty()) {
+    // Give the pooled memory back and try again.
+    Clear();
+    data = static_cast<uint8_t*>(malloc(*capacity));
+  }
+  return data;
+}
+
+void SurfacePool::Release(uint8_t* data, size_t capacity) {
+  used_since_trim_ = true;
+  if (capacity > memory_limit_) {
+    free(data);
+    return;
+  }
+  blocks_.push_back({data, capacity});
+  stats_.pooled_bytes += capacity;
+  Trim(memory_limit_);
+  if (!trim_timer_) {
+    trim_timer_ = MessageLoop::SetTimeout(kTrimDelayMs,
+                                          [this]() { OnTrimTimer(); });
+  }
+}
+
+void SurfacePool::Trim(size_t limit) {
+  while (stats_.pooled_bytes > limit) {
+    free(blocks_.front().data);
+    stats_.pooled_bytes -= blocks_.front().capacity;
+    blocks_.pop_front();
+  }
+}
+
+void SurfacePool::OnTrimTimer() {
+  trim_timer_ = 0;
+  if (!used_since_trim_) {
+    Clear();
+    return;
+  }
+  used_since_trim_ = false;
+  if (!blocks_.empty()) {
+    trim_timer_ = MessageLoop::SetTimeout(kTrimDelayMs,
+                                          [this]() { OnTrimTimer(); });
+  }
+}
+
+}  // namespace nu
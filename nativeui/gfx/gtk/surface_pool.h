@@ -0,0 +1,92 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_GTK_SURFACE_POOL_H_
+#define NATIVEUI_GFX_GTK_SURFACE_POOL_H_
+
+#include <cairo.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+
+#include "nativeui/message_loop.h"
+
+namespace nu {
+
+// Keep the pixel memory of destroyed image surfaces, so creating and resizing
+// canvases do not allocate new memory each time.
+//
+// Memory is bucketed by sizes rounded up to quarters of powers of 2. The pool
+// drops the oldest memory when exceeding the memory limit, and is cleared
+// after being idle for a while.
+class SurfacePool {
+ public:
+  struct Stats {
+    // Number of surfaces created with memory from the pool.
+    size_t hits = 0;
+    // Number of surfaces created with newly allocated memory.
+    size_t misses = 0;
+    // Number of resized surfaces that kept their memory.
+    size_t reuses = 0;
+    // Bytes of memory kept in the pool.
+    size_t pooled_bytes = 0;
+  };
+
+  SurfacePool();
+  ~SurfacePool();
+
+  SurfacePool& operator=(const SurfacePool&) = delete;
+  SurfacePool(const SurfacePool&) = delete;
+
+  // Create a cleared ARGB32 surface, the |width| and |height| are in pixels.
+  cairo_surface_t* CreateSurface(int width, int height, float scale_factor);
+
+  // Destroy |surface| and return a cleared surface with new size. The memory
+  // of |surface| is kept if the new size fits in it and is not much smaller,
+  // and there is no other reference to |surface|.
+  cairo_surface_t* ResizeSurface(cairo_surface_t* surface,
+                                 int width,
+                                 int height,
+                                 float scale_factor);
+
+  // Free all memory in the pool.
+  void Clear();
+
+  // Set the max bytes of memory kept in the pool.
+  void SetMemoryLimit(size_t limit);
+  size_t GetMemoryLimit() const { return memory_limit_; }
+
+  const Stats& stats() const { return stats_; }
+
+ private:
+  struct Block {
+    uint8_t* data;
+    size_t capacity;
+  };
+
+  static void OnSurfaceDestroyed(void* user_data);
+
+  cairo_surface_t* CreateSurfaceForBlock(Block* block,
+                                         int width,
+                                         int height,
+                                         float scale_factor);
+  // Return nullptr when out of memory.
+  uint8_t* Acquire(size_t size, size_t* capacity);
+  void Release(uint8_t* data, size_t capacity);
+  void Trim(size_t limit);
+  void OnTrimTimer();
+
+  // Free memory in the order of releasing.
+  std::list<Block> blocks_;
+  size_t memory_limit_;
+  Stats stats_;
+
+  bool used_since_trim_ = false;
+  MessageLoop::TimerId trim_timer_ = 0;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_GTK_SURFACE_POOL_H_
@@ -0,0 +1,125 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/gtk/text_shaper.h"
+
+#include <gdk/gdk.h>
+
+#include <algorithm>
+
+#include "base/system/sys_info.h"
+#include "base/threading/simple_thread.h"
+
+namespace nu {
+
+class TextShaper::Thread : public base::SimpleThread {
+ public:
+  explicit Thread(TextShaper* shaper)
+      : base::SimpleThread("YueTextShaper"), shaper_(shaper) {}
+
+  // base::SimpleThread:
+  void Run() override {
+    PangoContext* context = shaper_->CreateContext();
+    uint64_t generation = 0;
+    while (shaper_->WaitForJobs(&generation))
+      shaper_->RunJobs(context);
+    g_object_unref(context);
+  }
+
+ private:
+  TextShaper* shaper_;
+};
+
+TextShaper::Job::Job() {}
+
+TextShaper::Job::~Job() {
+  if (attrs)
+    pango_attr_list_unref(attrs);
+}
+
+TextShaper::TextShaper()
+    : has_jobs_(&lock_),
+      jobs_done_(&lock_) {
+  GdkScreen* screen = gdk_screen_get_default();
+  resolution_ = gdk_screen_get_resolution(screen);
+  const cairo_font_options_t* options = gdk_screen_get_font_options(screen);
+  font_options_ = options ? cairo_font_options_copy(options) : nullptr;
+
+  // Leave one core for the GUI thread, which is blocked anyway but other
+  // processes may need it.
+  int count = std::min(std::max(base::SysInfo::NumberOfProcessors() - 1, 1),
+                       8);
+  for (int i = 0; i < count; ++i) {
+    threads_.emplace_back(new Thread(this));
+    threads_.back()->Start();
+  }
+}
+
+TextShaper::~TextShaper() {
+  {
+    base::AutoLock auto_lock(lock_);
+    quit_ = true;
+  }
+  has_jobs_.Broadcast();
+  for (auto& thread : threads_)
+    thread->Join();
+  if (font_options_)
+    cairo_font_options_destroy(font_options_);
+}
+
+void TextShaper::Measure(std::vector<Job>* jobs) {
+  {
+    base::AutoLock auto_lock(lock_);
+    jobs_ = jobs;
+    next_job_ = 0;
+    finished_threads_ = 0;
+    ++generation_;
+  }
+  has_jobs_.Broadcast();
+  base::AutoLock auto_lock(lock_);
+  while (finished_threads_ < threads_.size())
+    jobs_done_.Wait();
+  jobs_ = nullptr;
+}
+
+PangoContext* TextShaper::CreateContext() const {
+  // The default font map is thread-local.
+  PangoContext* context = pango_font_map_create_context(
+      pango_cairo_font_map_get_default());
+  pango_context_set_language(context, pango_language_get_default());
+  pango_cairo_context_set_resolution(context, resolution_);
+  if (font_options_)
+    pango_cairo_context_set_font_options(context, font_options_);
+  return context;
+}
+
+bool TextShaper::WaitForJobs(uint64_t* generation) {
+  base::AutoLock auto_lock(lock_);
+  while (!quit_ && generation_ == *generation)
+    has_jobs_.Wait();
+  *generation = generation_;
+  return !quit_;
+}
+
+void TextShaper::RunJobs(PangoContext* context) {
+  PangoLayout* layout = pango_layout_new(context);
+  while (true) {
+    size_t i = next_job_++;
+    if (i >= jobs_->size())
+      break;
+    Job& job = (*jobs_)[i];
+    pango_layout_set_text(layout, job.text.c_str(), job.text.size());
+    pango_layout_set_attributes(layout, job.attrs);
+    pango_layout_set_alignment(layout, job.alignment);
+    pango_layout_set_ellipsize(layout, job.ellipsize);
+    pango_layout_get_pixel_size(layout, &job.width, &job.height);
+  }
+  g_object_unref(layout);
+
+  base::AutoLock auto_lock(lock_);
+  if (++finished_threads_ == threads_.size())
+    jobs_done_.Signal();
+}
+
+}  // namespace nu
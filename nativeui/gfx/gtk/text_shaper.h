@@ -0,0 +1,80 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_GTK_TEXT_SHAPER_H_
+#define NATIVEUI_GFX_GTK_TEXT_SHAPER_H_
+
+#include <pango/pangocairo.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/synchronization/condition_variable.h"
+#include "base/synchronization/lock.h"
+
+namespace nu {
+
+// Measure texts on a pool of background threads.
+//
+// PangoLayout and PangoContext are not thread-safe, so each thread creates its
+// own PangoContext from the thread-local default font map, with the same
+// settings of the screen.
+class TextShaper {
+ public:
+  struct Job {
+    Job();
+    ~Job();
+
+    Job& operator=(const Job&) = delete;
+    Job(const Job&) = delete;
+
+    // Input, the |attrs| is owned by the job.
+    std::string text;
+    PangoAttrList* attrs = nullptr;
+    PangoAlignment alignment = PANGO_ALIGN_LEFT;
+    PangoEllipsizeMode ellipsize = PANGO_ELLIPSIZE_NONE;
+
+    // Output, the pixel size of the text without size limits.
+    int width = 0;
+    int height = 0;
+  };
+
+  TextShaper();
+  ~TextShaper();
+
+  TextShaper& operator=(const TextShaper&) = delete;
+  TextShaper(const TextShaper&) = delete;
+
+  // Run the jobs in parallel, and wait until all of them are done.
+  void Measure(std::vector<Job>* jobs);
+
+ private:
+  class Thread;
+
+  // Called on worker threads.
+  PangoContext* CreateContext() const;
+  bool WaitForJobs(uint64_t* generation);
+  void RunJobs(PangoContext* context);
+
+  // Settings of the screen.
+  double resolution_;
+  cairo_font_options_t* font_options_;
+
+  std::vector<std::unique_ptr<Thread>> threads_;
+
+  base::Lock lock_;
+  base::ConditionVariable has_jobs_;
+  base::ConditionVariable jobs_done_;
+  std::vector<Job>* jobs_ = nullptr;
+  std::atomic<size_t> next_job_{0};
+  size_t finished_threads_ = 0;
+  uint64_t generation_ = 0;
+  bool quit_ = false;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_GTK_TEXT_SHAPER_H_
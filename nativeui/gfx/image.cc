@@ -4,9 +4,12 @@
 
 #include "nativeui/gfx/image.h"
 
+#include "base/files/file.h"
 #include "base/files/file_path.h"
+#include "base/files/file_util.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
+#include "nativeui/gfx/qoi_encoder.h"
 
 #if defined(OS_WIN)
 #include "base/strings/string_util_win.h"
@@ -41,6 +44,38 @@ ScaleFactorPair kScaleFactorPairs[] = {
 Image::Image(NativeImage image, float scale_factor)
     : scale_factor_(scale_factor), image_(image) {}
 
+bool Image::Encode(const EncodeOptions& options, const WriteFunc& write) const {
+  if (IsEmpty())
+    return false;
+  if (options.format == Format::QOI) {
+    return PlatformReadPixels(
+        [&write](const uint8_t* pixels, int width, int height, int stride) {
+          EncodeQOI(pixels, width, height, stride, write);
+        });
+  }
+  return PlatformEncode(options, write);
+}
+
+bool Image::EncodeToFile(const EncodeOptions& options,
+                         const base::FilePath& path) const {
+  base::File file(path, base::File::FLAG_CREATE_ALWAYS |
+                        base::File::FLAG_WRITE);
+  if (!file.IsValid())
+    return false;
+  bool write_failed = false;
+  bool success = Encode(options, [&file, &write_failed](const Buffer& chunk) {
+    int size = static_cast<int>(chunk.size());
+    if (!write_failed &&
+        file.WriteAtCurrentPos(static_cast<const char*>(chunk.content()),
+                               size) != size)
+      write_failed = true;
+  }) && !write_failed;
+  file.Close();
+  if (!success)
+    base::DeleteFile(path);
+  return success;
+}
+
 // static
 float Image::GetScaleFactorFromFilePath(const base::FilePath& path) {
   base::FilePath::StringType name(path.BaseName().RemoveExtension().value());
@@ -5,6 +5,7 @@
 #ifndef NATIVEUI_GFX_IMAGE_H_
 #define NATIVEUI_GFX_IMAGE_H_
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -31,6 +32,26 @@ namespace nu {
 
 class NATIVEUI_EXPORT Image : public base::RefCounted<Image> {
  public:
+  // Formats that image can be encoded to.
+  enum class Format {
+    PNG,
+    JPEG,
+    QOI,
+  };
+
+  struct EncodeOptions {
+    Format format = Format::PNG;
+    // PNG: Compression level from 0 to 9, -1 means using platform default.
+    int compression = -1;
+    // JPEG: Quality from 0 to 100.
+    int quality = 90;
+    // JPEG: Whether to write progressive JPEG.
+    bool progressive = false;
+  };
+
+  // Receives chunks of encoded data, the chunk is only valid in the call.
+  using WriteFunc = std::function<void(const Buffer& chunk)>;
+
   // Create an empty image.
   Image();
 
@@ -69,6 +90,15 @@ class NATIVEUI_EXPORT Image : public base::RefCounted<Image> {
   Buffer ToPNG() const;
   Buffer ToJPEG(int quality) const;
 
+  // Encode the image and pass the data to |write| in chunks, without keeping
+  // the whole encoded data in memory. Only the first frame of animated image
+  // is encoded.
+  bool Encode(const EncodeOptions& options, const WriteFunc& write) const;
+
+  // Encode the image and write to |path|.
+  bool EncodeToFile(const EncodeOptions& options,
+                    const base::FilePath& path) const;
+
   // Write the image to file.
   // Note: Do not make it a public API for now, we need to figure out a
   // universal type conversion API with options first.
@@ -106,6 +136,17 @@ class NATIVEUI_EXPORT Image : public base::RefCounted<Image> {
 
   static float GetScaleFactorFromFilePath(const base::FilePath& path);
 
+  // Encode the image to PNG or JPEG with native encoders.
+  bool PlatformEncode(const EncodeOptions& options,
+                      const WriteFunc& write) const;
+
+  // Call |callback| with the unpremultiplied RGBA pixels of the image.
+  using ReadPixelsCallback = std::function<void(const uint8_t* pixels,
+                                                int width,
+                                                int height,
+                                                int stride)>;
+  bool PlatformReadPixels(const ReadPixelsCallback& callback) const;
+
   float scale_factor_ = 1.f;
   NativeImage image_;
 
@@ -70,7 +70,7 @@ void AttributedText::PlatformSetColorFor(Color color, int start, int end) {
   [text_ endEditing];
 }
 
-RectF AttributedText::GetBoundsFor(const SizeF& size) const {
+RectF AttributedText::PlatformGetBoundsFor(const SizeF& size) const {
   int draw_options = 0;
   if (format_.wrap)
     draw_options |= NSStringDrawingUsesLineFragmentOrigin;
@@ -89,7 +89,7 @@ RectF AttributedText::GetBoundsFor(const SizeF& size) const {
   }
 }
 
-void AttributedText::SetText(const std::string& text) {
+void AttributedText::PlatformSetText(const std::string& text) {
   [text_ beginEditing];
   // Remove old attributes after length change.
   NSString* nsstr = base::SysUTF8ToNSString(text);
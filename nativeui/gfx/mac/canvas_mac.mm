@@ -33,6 +33,14 @@ void Canvas::PlatformDestroyBitmap(NativeBitmap bitmap) {
   CGContextRelease(bitmap);
 }
 
+// static
+NativeBitmap Canvas::PlatformResizeBitmap(NativeBitmap bitmap,
+                                          const SizeF& size,
+                                          float scale_factor) {
+  PlatformDestroyBitmap(bitmap);
+  return PlatformCreateBitmap(size, scale_factor);
+}
+
 // static
 Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
                                        const SizeF& size,
@@ -40,4 +48,20 @@ Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
   return new PainterMac(bitmap, size, scale_factor);
 }
 
+Canvas::Pixels Canvas::PlatformGetPixels() const {
+  Pixels pixels;
+  pixels.data = static_cast<uint8_t*>(CGBitmapContextGetData(bitmap_));
+  pixels.width = CGBitmapContextGetWidth(bitmap_);
+  pixels.height = CGBitmapContextGetHeight(bitmap_);
+  pixels.stride = CGBitmapContextGetBytesPerRow(bitmap_);
+  return pixels;
+}
+
+void Canvas::PlatformLockPixels() {
+  CGContextFlush(bitmap_);
+}
+
+void Canvas::PlatformUnlockPixels() {
+}
+
 }  // namespace nu
@@ -140,6 +140,7 @@ Font::Font(const base::FilePath& path, float size)
     : font_([NSFontFromPath(path, size) retain]) {}
 
 Font::~Font() {
+  Uncache();
   [font_ release];
 }
 
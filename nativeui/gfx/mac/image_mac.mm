@@ -6,6 +6,9 @@
 
 #import <Cocoa/Cocoa.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "base/mac/scoped_cftyperef.h"
 #include "base/mac/scoped_nsobject.h"
 #include "base/strings/pattern.h"
@@ -50,6 +53,13 @@ Buffer EncodeImage(NSImage* image,
                           [data](void*) { [data release]; });
 }
 
+// Pass the data written by ImageIO to Image::WriteFunc.
+size_t OnEncodedChunk(void* info, const void* data, size_t size) {
+  auto* write = static_cast<const Image::WriteFunc*>(info);
+  (*write)(Buffer::Wrap(data, size));
+  return size;
+}
+
 }  // namespace
 
 Image::Image() : image_([[NSImage alloc] init]) {}
@@ -184,7 +194,70 @@ Buffer Image::ToPNG() const {
 
 Buffer Image::ToJPEG(int quality) const {
   NSDictionary* options = @{NSImageCompressionFactor: @(quality / 100.f)};
-  return EncodeImage(image_, NSBitmapImageFileTypePNG, options);
+  return EncodeImage(image_, NSBitmapImageFileTypeJPEG, options);
+}
+
+bool Image::PlatformEncode(const EncodeOptions& options,
+                           const WriteFunc& write) const {
+  CGImageRef cg_image =
+      [image_ CGImageForProposedRect:nullptr context:nil hints:nil];
+  if (!cg_image)
+    return false;
+  CGDataConsumerCallbacks callbacks = {&OnEncodedChunk, nullptr};
+  base::ScopedCFTypeRef<CGDataConsumerRef> consumer(
+      CGDataConsumerCreate(const_cast<WriteFunc*>(&write), &callbacks));
+  // ImageIO does not provide options for PNG compression level.
+  bool is_jpeg = options.format == Format::JPEG;
+  base::ScopedCFTypeRef<CGImageDestinationRef> destination(
+      CGImageDestinationCreateWithDataConsumer(
+          consumer, is_jpeg ? CFSTR("public.jpeg") : CFSTR("public.png"),
+          1, nullptr));
+  if (!destination)
+    return false;
+  NSDictionary* properties = nil;
+  if (is_jpeg) {
+    float quality = std::max(0, std::min(options.quality, 100)) / 100.f;
+    properties = @{
+      (__bridge NSString*)kCGImageDestinationLossyCompressionQuality:
+          @(quality),
+      (__bridge NSString*)kCGImagePropertyJFIFDictionary: @{
+        (__bridge NSString*)kCGImagePropertyJFIFIsProgressive:
+            @(options.progressive),
+      },
+    };
+  }
+  CGImageDestinationAddImage(destination, cg_image,
+                             (__bridge CFDictionaryRef)properties);
+  return CGImageDestinationFinalize(destination);
+}
+
+bool Image::PlatformReadPixels(const ReadPixelsCallback& callback) const {
+  CGImageRef cg_image =
+      [image_ CGImageForProposedRect:nullptr context:nil hints:nil];
+  if (!cg_image)
+    return false;
+  size_t width = CGImageGetWidth(cg_image);
+  size_t height = CGImageGetHeight(cg_image);
+  std::vector<uint8_t> pixels(width * height * 4);
+  base::ScopedCFTypeRef<CGColorSpaceRef> color_space(
+      CGColorSpaceCreateWithName(kCGColorSpaceSRGB));
+  base::ScopedCFTypeRef<CGContextRef> context(CGBitmapContextCreate(
+      pixels.data(), width, height, 8, width * 4, color_space,
+      kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big));
+  if (!context)
+    return false;
+  CGContextSetBlendMode(context, kCGBlendModeCopy);
+  CGContextDrawImage(context, CGRectMake(0, 0, width, height), cg_image);
+  // CoreGraphics only draws with premultiplied alpha.
+  for (size_t i = 0; i < pixels.size(); i += 4) {
+    uint8_t a = pixels[i + 3];
+    if (a == 0 || a == 255)
+      continue;
+    for (size_t c = i; c < i + 3; ++c)
+      pixels[c] = std::min((pixels[c] * 255 + a / 2) / a, 255);
+  }
+  callback(pixels.data(), width, height, width * 4);
+  return true;
 }
 
 NSBitmapImageRep* Image::GetAnimationRep() const {
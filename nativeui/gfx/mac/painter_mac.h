@@ -6,6 +6,7 @@
 #define NATIVEUI_GFX_MAC_PAINTER_MAC_H_
 
 #include <string>
+#include <vector>
 
 #include "nativeui/gfx/painter.h"
 
@@ -49,6 +50,8 @@ class PainterMac : public Painter {
   void Clear() override;
   void StrokeRect(const RectF& rect) override;
   void FillRect(const RectF& rect) override;
+  void FillPath(const Path* path) override;
+  void StrokePath(const Path* path) override;
   void DrawImage(const Image* image, const RectF& rect) override;
   void DrawImageFromRect(const Image* image, const RectF& src,
                          const RectF& dest) override;
@@ -57,6 +60,7 @@ class PainterMac : public Painter {
                           const RectF& dest) override;
   void DrawAttributedText(scoped_refptr<AttributedText> text,
                           const RectF& rect) override;
+  std::vector<RectF> GetDirtyRects() override;
 
  private:
   // APIs of Core Graphics operate on current context, while we don't set
@@ -13,6 +13,7 @@
 #include "nativeui/gfx/canvas.h"
 #include "nativeui/gfx/font.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
 
 namespace nu {
 
@@ -212,6 +213,18 @@ void PainterMac::FillRect(const RectF& rect) {
   CGContextFillRect(context_, rect.ToCGRect());
 }
 
+void PainterMac::FillPath(const Path* path) {
+  CGContextBeginPath(context_);
+  CGContextAddPath(context_, path->GetNative());
+  CGContextFillPath(context_);
+}
+
+void PainterMac::StrokePath(const Path* path) {
+  CGContextBeginPath(context_);
+  CGContextAddPath(context_, path->GetNative());
+  CGContextStrokePath(context_);
+}
+
 void PainterMac::DrawImage(const Image* image, const RectF& rect) {
   GraphicsContextScope scoped(target_context_);
   [image->GetNative() drawInRect:rect.ToCGRect()
@@ -291,4 +304,8 @@ void PainterMac::DrawAttributedText(scoped_refptr<AttributedText> text,
                           context:nil];
 }
 
+std::vector<RectF> PainterMac::GetDirtyRects() {
+  return {RectF(CGContextGetClipBoundingBox(context_))};
+}
+
 }  // namespace nu
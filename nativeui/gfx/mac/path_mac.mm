@@ -0,0 +1,43 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#import <Cocoa/Cocoa.h>
+
+namespace nu {
+
+NativePath Path::PlatformCreate() const {
+  CGMutablePathRef path = CGPathCreateMutable();
+  for (size_t i = 0; i < data_.size();) {
+    const float* f = data_.data() + i + 1;
+    switch (static_cast<Command>(data_[i])) {
+      case Command::MoveTo:
+        CGPathMoveToPoint(path, nullptr, f[0], f[1]);
+        i += 3;
+        break;
+      case Command::LineTo:
+        CGPathAddLineToPoint(path, nullptr, f[0], f[1]);
+        i += 3;
+        break;
+      case Command::BezierCurveTo:
+        CGPathAddCurveToPoint(path, nullptr,
+                              f[0], f[1], f[2], f[3], f[4], f[5]);
+        i += 7;
+        break;
+      default:
+        CGPathCloseSubpath(path);
+        i += 1;
+        break;
+    }
+  }
+  return path;
+}
+
+// static
+void Path::PlatformDestroy(NativePath path) {
+  CGPathRelease(path);
+}
+
+}  // namespace nu
@@ -4,6 +4,9 @@
 
 #include "nativeui/gfx/painter.h"
 
+#define _USE_MATH_DEFINES
+#include <math.h>
+
 #include "nativeui/gfx/attributed_text.h"
 
 namespace nu {
@@ -12,9 +15,78 @@ Painter::Painter() : weak_factory_(this) {}
 
 Painter::~Painter() {}
 
+template<typename T>
+void Painter::FillBatch(size_t count, const Buffer& colors, const T& add_item) {
+  BeginPath();
+  if (colors.size() == 0) {
+    for (size_t i = 0; i < count; ++i)
+      add_item(i);
+    Fill();
+    return;
+  }
+  // Fill color is changed for each group, and restored at last.
+  Save();
+  Color color;
+  for (size_t i = 0; i < count; ++i) {
+    Color item_color = ReadBatchColor(colors, i);
+    if (i == 0 || item_color != color) {
+      if (i > 0)
+        Fill();
+      color = item_color;
+      SetFillColor(color);
+    }
+    add_item(i);
+  }
+  if (count > 0)
+    Fill();
+  Restore();
+}
+
 void Painter::DrawText(const std::string& str, const RectF& rect,
                        const TextAttributes& attributes) {
   DrawAttributedText(new AttributedText(str, attributes), rect);
 }
 
+void Painter::FillRects(const Buffer& rects, const Buffer& colors) {
+  FillBatch(GetBatchSize(rects, 4, colors), colors, [&](size_t i) {
+    float r[4];
+    ReadBatchItem(rects, i, 4, r);
+    Rect(RectF(r[0], r[1], r[2], r[3]));
+  });
+}
+
+void Painter::StrokePolyline(const Buffer& points) {
+  size_t count = GetBatchSize(points, 2, Buffer());
+  BeginPath();
+  for (size_t i = 0; i < count; ++i) {
+    float p[2];
+    ReadBatchItem(points, i, 2, p);
+    if (i == 0)
+      MoveTo(PointF(p[0], p[1]));
+    else
+      LineTo(PointF(p[0], p[1]));
+  }
+  Stroke();
+}
+
+void Painter::DrawPoints(const Buffer& points,
+                         float diameter,
+                         const Buffer& colors) {
+  float radius = diameter / 2;
+  FillBatch(GetBatchSize(points, 2, colors), colors, [&](size_t i) {
+    float p[2];
+    ReadBatchItem(points, i, 2, p);
+    MoveTo(PointF(p[0] + radius, p[1]));
+    Arc(PointF(p[0], p[1]), radius, 0, 2 * M_PI);
+  });
+}
+
+bool Painter::IsRectDirty(const RectF& rect) {
+  for (const RectF& dirty : GetDirtyRects()) {
+    if (dirty.Intersects(rect))
+      return true;
+  }
+  return false;
+}
+
 }  // namespace nu
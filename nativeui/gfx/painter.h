@@ -5,10 +5,16 @@
 #ifndef NATIVEUI_GFX_PAINTER_H_
 #define NATIVEUI_GFX_PAINTER_H_
 
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "nativeui/buffer.h"
 #include "nativeui/gfx/geometry/rect_f.h"
 #include "nativeui/gfx/text.h"
 #include "nativeui/types.h"
@@ -22,6 +28,7 @@ namespace nu {
 class AttributedText;
 class Canvas;
 class Image;
+class Path;
 
 enum class BlendMode : int {
   Normal = 0,
@@ -114,6 +121,30 @@ class NATIVEUI_EXPORT Painter {
   virtual void DrawPath() = 0;
 #endif
 
+  // Fill or stroke a prebuilt |path| under current transform, which is faster
+  // than building the path every time. Current path is cleared.
+  virtual void FillPath(const Path* path) = 0;
+  virtual void StrokePath(const Path* path) = 0;
+
+  // Batched drawing, which draws lots of items with one call.
+  //
+  // The items are packed floats, and |colors| has a 32-bit ARGB color for each
+  // item, in the same format with Color::value(). When |colors| is empty the
+  // fill color is used, otherwise only the items that have colors are drawn.
+  // Adjacent items of the same color are filled as one shape, so their
+  // overlapped areas are not blended twice. Current path is cleared.
+
+  // Fill rectangles, each one has 4 floats: x, y, width and height.
+  virtual void FillRects(const Buffer& rects, const Buffer& colors);
+
+  // Stroke the lines connecting |points|, each one has 2 floats: x and y.
+  virtual void StrokePolyline(const Buffer& points);
+
+  // Fill circles of |diameter| centered at |points|, each one has 2 floats.
+  virtual void DrawPoints(const Buffer& points,
+                          float diameter,
+                          const Buffer& colors);
+
   // Draw image.
   virtual void DrawImage(const Image* image, const RectF& rect) = 0;
   virtual void DrawImageFromRect(const Image* image, const RectF& src,
@@ -132,12 +163,62 @@ class NATIVEUI_EXPORT Painter {
   virtual void DrawText(const std::string& text, const RectF& rect,
                         const TextAttributes& attributes);
 
+  // Return the areas that need to be redrawn, which are the rectangles of
+  // current clip in current coordinates.
+  virtual std::vector<RectF> GetDirtyRects() = 0;
+
+  // Return whether |rect| intersects with the areas that need to be redrawn,
+  // drawing outside of them can be skipped.
+  virtual bool IsRectDirty(const RectF& rect);
+
+#if defined(OS_LINUX)
+  // Draw text with glyphs cached in an atlas of alpha masks, which is faster
+  // when drawing lots of text repeatedly.
+  virtual void SetUseGlyphAtlas(bool use) = 0;
+#endif
+
   base::WeakPtr<Painter> GetWeakPtr() { return weak_factory_.GetWeakPtr(); }
 
  protected:
   Painter();
 
+  // Return the number of items of batched drawing, each item has |size|
+  // floats in |data|.
+  static size_t GetBatchSize(const Buffer& data,
+                             size_t size,
+                             const Buffer& colors) {
+    size_t count = data.size() / (size * sizeof(float));
+    if (colors.size() > 0)
+      count = std::min(count, colors.size() / sizeof(uint32_t));
+    return count;
+  }
+
+  // Read the |index|th item of batched drawing, the data from bindings may not
+  // be aligned.
+  static void ReadBatchItem(const Buffer& data,
+                            size_t index,
+                            size_t size,
+                            float* out) {
+    memcpy(out,
+           static_cast<const uint8_t*>(data.content()) +
+               index * size * sizeof(float),
+           size * sizeof(float));
+  }
+
+  static Color ReadBatchColor(const Buffer& colors, size_t index) {
+    uint32_t value;
+    memcpy(&value,
+           static_cast<const uint8_t*>(colors.content()) +
+               index * sizeof(uint32_t),
+           sizeof(uint32_t));
+    return Color(value);
+  }
+
  private:
+  // Add items to path with |add_item| and fill them grouped by colors.
+  template<typename T>
+  void FillBatch(size_t count, const Buffer& colors, const T& add_item);
+
   base::WeakPtrFactory<Painter> weak_factory_;
 };
 
@@ -0,0 +1,480 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#define _USE_MATH_DEFINES
+#include <ctype.h>
+#include <math.h>
+
+#include <algorithm>
+
+namespace nu {
+
+namespace {
+
+// Number of arguments of each command.
+const size_t kArgsCount[] = {2, 2, 6, 4, 5, 0};
+
+// A minimal tokenizer of SVG path data.
+//
+// Numbers are parsed manually since strtod depends on locale.
+class SVGPathReader {
+ public:
+  explicit SVGPathReader(const std::string& data) : data_(data) {}
+
+  // Read a command letter, return false if the next token is not one.
+  bool ReadCommand(char* command) {
+    SkipSpaces();
+    if (AtEnd() || !isalpha(static_cast<unsigned char>(Peek())))
+      return false;
+    *command = data_[pos_++];
+    return true;
+  }
+
+  bool ReadNumber(float* out) {
+    SkipSeparators();
+    size_t start = pos_;
+    double sign = 1;
+    if (!AtEnd() && (Peek() == '+' || Peek() == '-')) {
+      if (Peek() == '-')
+        sign = -1;
+      ++pos_;
+    }
+    double value = 0;
+    bool has_digits = false;
+    while (!AtEnd() && isdigit(static_cast<unsigned char>(Peek()))) {
+      value = value * 10 + (data_[pos_++] - '0');
+      has_digits = true;
+    }
+    if (!AtEnd() && Peek() == '.') {
+      ++pos_;
+      double scale = 0.1;
+      while (!AtEnd() && isdigit(static_cast<unsigned char>(Peek()))) {
+        value += (data_[pos_++] - '0') * scale;
+        scale /= 10;
+        has_digits = true;
+      }
+    }
+    if (!has_digits) {
+      pos_ = start;
+      return false;
+    }
+    if (!AtEnd() && (Peek() == 'e' || Peek() == 'E')) {
+      size_t exponent_start = pos_++;
+      int exponent_sign = 1;
+      if (!AtEnd() && (Peek() == '+' || Peek() == '-')) {
+        if (Peek() == '-')
+          exponent_sign = -1;
+        ++pos_;
+      }
+      int exponent = 0;
+      bool has_exponent = false;
+      while (!AtEnd() && isdigit(static_cast<unsigned char>(Peek()))) {
+        exponent = std::min(exponent * 10 + (data_[pos_++] - '0'), 1000);
+        has_exponent = true;
+      }
+      if (has_exponent)
+        value *= pow(10, exponent_sign * exponent);
+      else
+        pos_ = exponent_start;
+    }
+    *out = static_cast<float>(sign * value);
+    return true;
+  }
+
+  // Flags of arcs are single characters that may not be separated.
+  bool ReadFlag(bool* out) {
+    SkipSeparators();
+    if (AtEnd() || (Peek() != '0' && Peek() != '1'))
+      return false;
+    *out = data_[pos_++] == '1';
+    return true;
+  }
+
+  bool ReadNumbers(std::initializer_list<float*> outs) {
+    for (float* out : outs) {
+      if (!ReadNumber(out))
+        return false;
+    }
+    return true;
+  }
+
+  bool AtEnd() const { return pos_ >= data_.size(); }
+
+ private:
+  char Peek() const { return data_[pos_]; }
+
+  void SkipSpaces() {
+    while (!AtEnd() && isspace(static_cast<unsigned char>(Peek())))
+      ++pos_;
+  }
+
+  void SkipSeparators() {
+    SkipSpaces();
+    if (!AtEnd() && Peek() == ',') {
+      ++pos_;
+      SkipSpaces();
+    }
+  }
+
+  const std::string& data_;
+  size_t pos_ = 0;
+};
+
+PointF Reflect(const PointF& point, const PointF& center) {
+  return PointF(2 * center.x() - point.x(), 2 * center.y() - point.y());
+}
+
+}  // namespace
+
+Path::Path() {}
+
+Path::Path(const std::string& svg) {
+  AddSVG(svg);
+}
+
+Path::Path(const std::vector<float>& data) {
+  AddData(data);
+}
+
+Path::~Path() {
+  Invalidate();
+}
+
+void Path::MoveTo(const PointF& point) {
+  Push(Command::MoveTo, {point});
+  has_current_point_ = true;
+  current_point_ = start_point_ = point;
+}
+
+void Path::LineTo(const PointF& point) {
+  if (!has_current_point_) {
+    MoveTo(point);
+    return;
+  }
+  Push(Command::LineTo, {point});
+  current_point_ = point;
+}
+
+void Path::BezierCurveTo(const PointF& cp1,
+                         const PointF& cp2,
+                         const PointF& ep) {
+  if (!has_current_point_)
+    MoveTo(cp1);
+  Push(Command::BezierCurveTo, {cp1, cp2, ep});
+  current_point_ = ep;
+}
+
+void Path::QuadraticCurveTo(const PointF& cp, const PointF& ep) {
+  if (!has_current_point_)
+    MoveTo(cp);
+  const PointF& sp = current_point_;
+  BezierCurveTo(PointF(sp.x() + 2.f / 3 * (cp.x() - sp.x()),
+                       sp.y() + 2.f / 3 * (cp.y() - sp.y())),
+                PointF(ep.x() + 2.f / 3 * (cp.x() - ep.x()),
+                       ep.y() + 2.f / 3 * (cp.y() - ep.y())),
+                ep);
+}
+
+void Path::Arc(const PointF& point, float radius, float sa, float ea) {
+  if (radius <= 0) {
+    LineTo(point);
+    return;
+  }
+  PointF start(point.x() + radius * cosf(sa), point.y() + radius * sinf(sa));
+  if (has_current_point_)
+    LineTo(start);
+  else
+    MoveTo(start);
+  // Arcs always go in the direction of increasing angles, and drawing more
+  // than a full circle results in the same shape.
+  float sweep = ea - sa;
+  if (sweep < 0)
+    sweep += ceilf(-sweep / (2 * M_PI)) * 2 * M_PI;
+  AddArcSegments(point, radius, radius, 0, sa,
+                 std::min(sweep, static_cast<float>(2 * M_PI)));
+}
+
+void Path::Rect(const RectF& rect) {
+  MoveTo(rect.origin());
+  LineTo(rect.top_right());
+  LineTo(rect.bottom_right());
+  LineTo(rect.bottom_left());
+  ClosePath();
+}
+
+void Path::ClosePath() {
+  if (!has_current_point_)
+    return;
+  Push(Command::ClosePath, {});
+  current_point_ = start_point_;
+}
+
+void Path::Clear() {
+  Invalidate();
+  data_.clear();
+  bounds_ = RectF();
+  has_current_point_ = false;
+  current_point_ = start_point_ = PointF();
+}
+
+NativePath Path::GetNative() const {
+  if (!path_)
+    path_ = PlatformCreate();
+  return path_;
+}
+
+void Path::AddSVG(const std::string& svg) {
+  SVGPathReader reader(svg);
+  char command = 0;
+  // The last control point, used by the shorthand curve commands.
+  char last_curve = 0;
+  PointF last_control;
+  while (!reader.AtEnd()) {
+    if (!reader.ReadCommand(&command)) {
+      // Numbers without command letter repeat the last command.
+      if (command == 0 || command == 'z' || command == 'Z')
+        return;
+    }
+    char type = static_cast<char>(tolower(command));
+    if (!has_current_point_ && type != 'm')
+      return;
+    bool relative = islower(command);
+    float ox = relative ? current_point_.x() : 0;
+    float oy = relative ? current_point_.y() : 0;
+    char curve = 0;
+    switch (type) {
+      case 'm': {
+        float x, y;
+        if (!reader.ReadNumbers({&x, &y}))
+          return;
+        MoveTo(PointF(ox + x, oy + y));
+        // Following coordinates are treated as LineTo.
+        command = relative ? 'l' : 'L';
+        break;
+      }
+      case 'l': {
+        float x, y;
+        if (!reader.ReadNumbers({&x, &y}))
+          return;
+        LineTo(PointF(ox + x, oy + y));
+        break;
+      }
+      case 'h': {
+        float x;
+        if (!reader.ReadNumber(&x))
+          return;
+        LineTo(PointF(ox + x, current_point_.y()));
+        break;
+      }
+      case 'v': {
+        float y;
+        if (!reader.ReadNumber(&y))
+          return;
+        LineTo(PointF(current_point_.x(), oy + y));
+        break;
+      }
+      case 'c':
+      case 's': {
+        float x1, y1, x2, y2, x, y;
+        if (type == 'c') {
+          if (!reader.ReadNumbers({&x1, &y1, &x2, &y2, &x, &y}))
+            return;
+          x1 += ox;
+          y1 += oy;
+        } else {
+          if (!reader.ReadNumbers({&x2, &y2, &x, &y}))
+            return;
+          PointF cp1 = last_curve == 'c' ?
+              Reflect(last_control, current_point_) : current_point_;
+          x1 = cp1.x();
+          y1 = cp1.y();
+        }
+        last_control = PointF(ox + x2, oy + y2);
+        BezierCurveTo(PointF(x1, y1), last_control, PointF(ox + x, oy + y));
+        curve = 'c';
+        break;
+      }
+      case 'q':
+      case 't': {
+        float x1, y1, x, y;
+        if (type == 'q') {
+          if (!reader.ReadNumbers({&x1, &y1, &x, &y}))
+            return;
+          last_control = PointF(ox + x1, oy + y1);
+        } else {
+          if (!reader.ReadNumbers({&x, &y}))
+            return;
+          last_control = last_curve == 'q' ?
+              Reflect(last_control, current_point_) : current_point_;
+        }
+        QuadraticCurveTo(last_control, PointF(ox + x, oy + y));
+        curve = 'q';
+        break;
+      }
+      case 'a': {
+        float rx, ry, angle, x, y;
+        bool large_arc, sweep;
+        if (!reader.ReadNumbers({&rx, &ry, &angle}) ||
+            !reader.ReadFlag(&large_arc) || !reader.ReadFlag(&sweep) ||
+            !reader.ReadNumbers({&x, &y}))
+          return;
+        AddEllipticalArc(rx, ry, angle * M_PI / 180, large_arc, sweep,
+                         PointF(ox + x, oy + y));
+        break;
+      }
+      case 'z':
+        ClosePath();
+        break;
+      default:
+        return;
+    }
+    last_curve = curve;
+  }
+}
+
+void Path::AddData(const std::vector<float>& data) {
+  const float* f = data.data();
+  const float* end = f + data.size();
+  while (f < end) {
+    if (!(*f >= 0 && *f <= static_cast<int>(Command::ClosePath)))
+      return;
+    int command = static_cast<int>(*f);
+    if (command != *f ||
+        static_cast<size_t>(end - f - 1) < kArgsCount[command])
+      return;
+    ++f;
+    switch (static_cast<Command>(command)) {
+      case Command::MoveTo:
+        MoveTo(PointF(f[0], f[1]));
+        break;
+      case Command::LineTo:
+        LineTo(PointF(f[0], f[1]));
+        break;
+      case Command::BezierCurveTo:
+        BezierCurveTo(PointF(f[0], f[1]), PointF(f[2], f[3]),
+                      PointF(f[4], f[5]));
+        break;
+      case Command::QuadraticCurveTo:
+        QuadraticCurveTo(PointF(f[0], f[1]), PointF(f[2], f[3]));
+        break;
+      case Command::Arc:
+        Arc(PointF(f[0], f[1]), f[2], f[3], f[4]);
+        break;
+      case Command::ClosePath:
+        ClosePath();
+        break;
+    }
+    f += kArgsCount[command];
+  }
+}
+
+void Path::AddArcSegments(const PointF& center, float rx, float ry,
+                          float angle, float sa, float sweep) {
+  // Each segment spans at most a quarter of the ellipse, which keeps the
+  // error of approximation under 0.03%.
+  int count = static_cast<int>(ceil(fabs(sweep) / M_PI_2 - 1e-4));
+  if (count <= 0)
+    return;
+  double step = static_cast<double>(sweep) / count;
+  double k = 4.0 / 3 * tan(step / 4);
+  double cos_angle = cos(angle);
+  double sin_angle = sin(angle);
+  auto map = [&](double x, double y) {
+    x *= rx;
+    y *= ry;
+    return PointF(center.x() + x * cos_angle - y * sin_angle,
+                  center.y() + x * sin_angle + y * cos_angle);
+  };
+  double a0 = sa;
+  for (int i = 0; i < count; ++i) {
+    double a1 = a0 + step;
+    double cos0 = cos(a0), sin0 = sin(a0);
+    double cos1 = cos(a1), sin1 = sin(a1);
+    BezierCurveTo(map(cos0 - k * sin0, sin0 + k * cos0),
+                  map(cos1 + k * sin1, sin1 - k * cos1),
+                  map(cos1, sin1));
+    a0 = a1;
+  }
+}
+
+// Implementation of https://www.w3.org/TR/SVG/implnote.html#ArcConversionEndpointToCenter
+void Path::AddEllipticalArc(float rx, float ry, float angle,
+                            bool large_arc, bool sweep, const PointF& ep) {
+  PointF sp = current_point_;
+  if (sp == ep)
+    return;
+  rx = fabsf(rx);
+  ry = fabsf(ry);
+  if (rx == 0 || ry == 0) {
+    LineTo(ep);
+    return;
+  }
+  double cos_angle = cos(angle);
+  double sin_angle = sin(angle);
+  double dx = (sp.x() - ep.x()) / 2;
+  double dy = (sp.y() - ep.y()) / 2;
+  double x1 = cos_angle * dx + sin_angle * dy;
+  double y1 = -sin_angle * dx + cos_angle * dy;
+  // Scale up the radii when they can not reach the end point.
+  double lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+  if (lambda > 1) {
+    rx *= sqrt(lambda);
+    ry *= sqrt(lambda);
+  }
+  double rx2 = rx * rx, ry2 = ry * ry;
+  double denominator = rx2 * y1 * y1 + ry2 * x1 * x1;
+  double coef = sqrt(std::max(0.0, (rx2 * ry2 - denominator) / denominator));
+  if (large_arc == sweep)
+    coef = -coef;
+  double cx1 = coef * rx * y1 / ry;
+  double cy1 = -coef * ry * x1 / rx;
+  PointF center(cos_angle * cx1 - sin_angle * cy1 + (sp.x() + ep.x()) / 2,
+                sin_angle * cx1 + cos_angle * cy1 + (sp.y() + ep.y()) / 2);
+  double theta1 = atan2((y1 - cy1) / ry, (x1 - cx1) / rx);
+  double theta2 = atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx);
+  double delta = theta2 - theta1;
+  if (!sweep && delta > 0)
+    delta -= 2 * M_PI;
+  else if (sweep && delta < 0)
+    delta += 2 * M_PI;
+  size_t size = data_.size();
+  AddArcSegments(center, rx, ry, angle, theta1, delta);
+  // Avoid accumulated errors on the end point.
+  if (data_.size() > size) {
+    data_[data_.size() - 2] = ep.x();
+    data_[data_.size() - 1] = ep.y();
+    current_point_ = ep;
+  }
+}
+
+void Path::Push(Command command, std::initializer_list<PointF> points) {
+  Invalidate();
+  bool is_first = data_.empty();
+  for (const PointF& point : points) {
+    if (is_first) {
+      bounds_ = RectF(point, SizeF());
+      is_first = false;
+    } else {
+      float left = std::min(bounds_.x(), point.x());
+      float top = std::min(bounds_.y(), point.y());
+      float right = std::max(bounds_.right(), point.x());
+      float bottom = std::max(bounds_.bottom(), point.y());
+      bounds_ = RectF(left, top, right - left, bottom - top);
+    }
+  }
+  data_.push_back(static_cast<float>(command));
+  for (const PointF& point : points)
+    data_.insert(data_.end(), {point.x(), point.y()});
+}
+
+void Path::Invalidate() {
+  if (path_) {
+    PlatformDestroy(path_);
+    path_ = nullptr;
+  }
+}
+
+}  // namespace nu
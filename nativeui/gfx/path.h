@@ -0,0 +1,120 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_PATH_H_
+#define NATIVEUI_GFX_PATH_H_
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/geometry/rect_f.h"
+#include "nativeui/nativeui_export.h"
+#include "nativeui/types.h"
+
+namespace nu {
+
+// A reusable path that can be built once and drawn many times with
+// Painter::FillPath and Painter::StrokePath.
+//
+// Arcs and quadratic curves are converted to cubic Bezier curves when added,
+// so the path only consists of move, line, curve and close commands.
+class NATIVEUI_EXPORT Path : public base::RefCounted<Path> {
+ public:
+  // Commands in the packed data, each one is followed by its arguments:
+  // MoveTo x y
+  // LineTo x y
+  // BezierCurveTo cp1x cp1y cp2x cp2y x y
+  // QuadraticCurveTo cpx cpy x y
+  // Arc x y radius startAngle endAngle
+  // ClosePath
+  enum class Command : int {
+    MoveTo = 0,
+    LineTo = 1,
+    BezierCurveTo = 2,
+    QuadraticCurveTo = 3,
+    Arc = 4,
+    ClosePath = 5,
+  };
+
+  // Create an empty path.
+  Path();
+
+  // Create from SVG path data, like "M10 10 h 80 v 80 z". As in SVG, the data
+  // is parsed until the first error and the commands before it are kept.
+  explicit Path(const std::string& svg);
+
+  // Create from packed data, which is parsed until the first invalid command.
+  explicit Path(const std::vector<float>& data);
+
+  // Path operations, which have the same behaviors with the ones of Painter.
+  void MoveTo(const PointF& point);
+  void LineTo(const PointF& point);
+  void BezierCurveTo(const PointF& cp1,
+                     const PointF& cp2,
+                     const PointF& ep);
+  void QuadraticCurveTo(const PointF& cp, const PointF& ep);
+  void Arc(const PointF& point, float radius, float sa, float ea);
+  void Rect(const RectF& rect);
+  void ClosePath();
+
+  // Remove all commands.
+  void Clear();
+
+  // Return whether there is no command.
+  bool IsEmpty() const { return data_.empty(); }
+
+  // Return the bounds including control points, which may be larger than the
+  // area actually covered by the path.
+  RectF GetBounds() const { return bounds_; }
+
+  // Return the commands in packed data, which only has MoveTo, LineTo,
+  // BezierCurveTo and ClosePath commands.
+  std::vector<float> GetData() const { return data_; }
+
+  // Return the native path, which is created on demand and kept until the
+  // path is changed.
+  NativePath GetNative() const;
+
+ protected:
+  virtual ~Path();
+
+ private:
+  friend class base::RefCounted<Path>;
+
+  // Parse and add commands.
+  void AddSVG(const std::string& svg);
+  void AddData(const std::vector<float>& data);
+
+  // Add an elliptical arc starting from current point.
+  void AddArcSegments(const PointF& center, float rx, float ry, float angle,
+                      float sa, float sweep);
+  void AddEllipticalArc(float rx, float ry, float angle,
+                        bool large_arc, bool sweep, const PointF& ep);
+
+  // Append |command| with |points| to data.
+  void Push(Command command, std::initializer_list<PointF> points);
+
+  // Destroy the cached native path after changes.
+  void Invalidate();
+
+  // Platform implementations.
+  NativePath PlatformCreate() const;
+  static void PlatformDestroy(NativePath path);
+
+  std::vector<float> data_;
+  RectF bounds_;
+
+  // Current point and start point of current subpath.
+  bool has_current_point_ = false;
+  PointF current_point_;
+  PointF start_point_;
+
+  mutable NativePath path_ = nullptr;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_PATH_H_
@@ -0,0 +1,116 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/qoi_encoder.h"
+
+#include <string.h>
+
+#include <vector>
+
+namespace nu {
+
+namespace {
+
+constexpr uint8_t kOpIndex = 0x00;
+constexpr uint8_t kOpDiff = 0x40;
+constexpr uint8_t kOpLuma = 0x80;
+constexpr uint8_t kOpRun = 0xc0;
+constexpr uint8_t kOpRGB = 0xfe;
+constexpr uint8_t kOpRGBA = 0xff;
+constexpr int kMaxRun = 62;
+
+// Encoded data is passed in chunks of this size.
+constexpr size_t kChunkSize = 64 * 1024;
+
+// A pixel takes at most 6 bytes, when a run ends with a RGBA op.
+constexpr size_t kMaxPixelSize = 6;
+
+void PushUint32(std::vector<uint8_t>* chunk, uint32_t value) {
+  chunk->push_back(value >> 24);
+  chunk->push_back(value >> 16);
+  chunk->push_back(value >> 8);
+  chunk->push_back(value);
+}
+
+}  // namespace
+
+void EncodeQOI(const uint8_t* pixels,
+               int width,
+               int height,
+               int stride,
+               const std::function<void(const Buffer& chunk)>& write) {
+  std::vector<uint8_t> chunk;
+  chunk.reserve(kChunkSize);
+  auto flush = [&chunk, &write]() {
+    if (chunk.empty())
+      return;
+    write(Buffer::Wrap(chunk.data(), chunk.size()));
+    chunk.clear();
+  };
+
+  // Header, with 4 channels and sRGB color space.
+  chunk.insert(chunk.end(), {'q', 'o', 'i', 'f'});
+  PushUint32(&chunk, width);
+  PushUint32(&chunk, height);
+  chunk.push_back(4);
+  chunk.push_back(0);
+
+  uint8_t index[64][4] = {};
+  uint8_t prev[4] = {0, 0, 0, 255};
+  int run = 0;
+  for (int y = 0; y < height; ++y) {
+    const uint8_t* row = pixels + static_cast<size_t>(y) * stride;
+    for (int x = 0; x < width; ++x) {
+      const uint8_t* px = row + x * 4;
+      if (chunk.size() + kMaxPixelSize > kChunkSize)
+        flush();
+      if (memcmp(px, prev, 4) == 0) {
+        if (++run == kMaxRun) {
+          chunk.push_back(kOpRun | (run - 1));
+          run = 0;
+        }
+        continue;
+      }
+      if (run > 0) {
+        chunk.push_back(kOpRun | (run - 1));
+        run = 0;
+      }
+      int hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+      if (memcmp(index[hash], px, 4) == 0) {
+        chunk.push_back(kOpIndex | hash);
+      } else {
+        memcpy(index[hash], px, 4);
+        if (px[3] == prev[3]) {
+          // The differences wrap around.
+          int8_t dr = static_cast<int8_t>(px[0] - prev[0]);
+          int8_t dg = static_cast<int8_t>(px[1] - prev[1]);
+          int8_t db = static_cast<int8_t>(px[2] - prev[2]);
+          int8_t dr_dg = static_cast<int8_t>(dr - dg);
+          int8_t db_dg = static_cast<int8_t>(db - dg);
+          if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 &&
+              db >= -2 && db <= 1) {
+            chunk.push_back(kOpDiff | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+          } else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 &&
+                     db_dg >= -8 && db_dg <= 7) {
+            chunk.push_back(kOpLuma | (dg + 32));
+            chunk.push_back((dr_dg + 8) << 4 | (db_dg + 8));
+          } else {
+            chunk.insert(chunk.end(), {kOpRGB, px[0], px[1], px[2]});
+          }
+        } else {
+          chunk.insert(chunk.end(), {kOpRGBA, px[0], px[1], px[2], px[3]});
+        }
+      }
+      memcpy(prev, px, 4);
+    }
+  }
+  if (run > 0)
+    chunk.push_back(kOpRun | (run - 1));
+
+  // End marker.
+  chunk.insert(chunk.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+  flush();
+}
+
+}  // namespace nu
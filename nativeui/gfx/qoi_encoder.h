@@ -0,0 +1,29 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_QOI_ENCODER_H_
+#define NATIVEUI_GFX_QOI_ENCODER_H_
+
+#include <stdint.h>
+
+#include <functional>
+
+#include "nativeui/buffer.h"
+
+namespace nu {
+
+// Encode unpremultiplied RGBA |pixels| into the "Quite OK Image" format, which
+// is lossless and much faster to encode than PNG. The encoded data is passed
+// to |write| in chunks.
+//
+// See https://qoiformat.org/qoi-specification.pdf for the format.
+void EncodeQOI(const uint8_t* pixels,
+               int width,
+               int height,
+               int stride,
+               const std::function<void(const Buffer& chunk)>& write);
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_QOI_ENCODER_H_
@@ -4,6 +4,8 @@
 
 #include "nativeui/gfx/canvas.h"
 
+#include <stdlib.h>
+
 #include "nativeui/gfx/geometry/size_conversions.h"
 #include "nativeui/gfx/win/double_buffer.h"
 #include "nativeui/gfx/win/painter_win.h"
@@ -24,6 +26,14 @@ void Canvas::PlatformDestroyBitmap(NativeBitmap bitmap) {
   delete bitmap;
 }
 
+// static
+NativeBitmap Canvas::PlatformResizeBitmap(NativeBitmap bitmap,
+                                          const SizeF& size,
+                                          float scale_factor) {
+  PlatformDestroyBitmap(bitmap);
+  return PlatformCreateBitmap(size, scale_factor);
+}
+
 // static
 Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
                                        const SizeF& size,
@@ -31,4 +41,29 @@ Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
   return new PainterWin(bitmap->dc(), bitmap->size(), scale_factor);
 }
 
+Canvas::Pixels Canvas::PlatformGetPixels() const {
+  Pixels pixels;
+  DIBSECTION dib = {{0}};
+  if (::GetObject(bitmap_->bitmap(), sizeof(dib), &dib) != sizeof(dib))
+    return pixels;
+  pixels.data = static_cast<uint8_t*>(dib.dsBm.bmBits);
+  pixels.width = dib.dsBmih.biWidth;
+  pixels.height = std::abs(dib.dsBmih.biHeight);
+  pixels.stride = dib.dsBm.bmWidthBytes;
+  // Rows of bottom-up DIB start from the last one.
+  if (dib.dsBmih.biHeight > 0) {
+    pixels.data += (pixels.height - 1) * pixels.stride;
+    pixels.stride = -pixels.stride;
+  }
+  return pixels;
+}
+
+void Canvas::PlatformLockPixels() {
+  static_cast<PainterWin*>(painter_.get())->Flush();
+  ::GdiFlush();
+}
+
+void Canvas::PlatformUnlockPixels() {
+}
+
 }  // namespace nu
@@ -31,6 +31,7 @@ class DoubleBuffer {
   std::unique_ptr<Gdiplus::Bitmap> GetGdiplusBitmap() const;
 
   HDC dc() const { return mem_dc_.Get(); }
+  HBITMAP bitmap() const { return mem_bitmap_.get(); }
   Size size() const { return size_; }
 
  private:
@@ -81,6 +81,7 @@ Font::Font(const base::FilePath& path, float size)
 }
 
 Font::~Font() {
+  Uncache();
   delete font_;
 }
 
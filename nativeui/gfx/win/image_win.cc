@@ -7,6 +7,9 @@
 #include <shlwapi.h>
 #include <wrl.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "base/logging.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/win/scoped_hglobal.h"
@@ -152,6 +155,74 @@ Buffer Image::ToJPEG(int quality) const {
   return EncodeImage(image_, L"image/jpeg", &params);
 }
 
+bool Image::PlatformEncode(const EncodeOptions& options,
+                           const WriteFunc& write) const {
+  // GDI+ does not provide options for PNG compression level, and does not
+  // write progressive JPEG.
+  bool is_jpeg = options.format == Format::JPEG;
+  CLSID encoder;
+  if (!GetEncoderClsid(is_jpeg ? L"image/jpeg" : L"image/png", &encoder))
+    return false;
+  ULONG quality = std::max(0, std::min(options.quality, 100));
+  Gdiplus::EncoderParameters params;
+  params.Count = 1;
+  params.Parameter[0].Guid = Gdiplus::EncoderQuality;
+  params.Parameter[0].Type = Gdiplus::EncoderParameterValueTypeLong;
+  params.Parameter[0].NumberOfValues = 1;
+  params.Parameter[0].Value = &quality;
+  // The encoders seek back when writing, so the data can only be passed after
+  // encoding finishes.
+  Microsoft::WRL::ComPtr<IStream> stream;
+  if (FAILED(::CreateStreamOnHGlobal(nullptr, TRUE, &stream)))
+    return false;
+  Gdiplus::Image* image = const_cast<Gdiplus::Image*>(image_);
+  if (image->Save(stream.Get(), &encoder,
+                  is_jpeg ? &params : nullptr) != Gdiplus::Ok)
+    return false;
+  STATSTG stat;
+  HGLOBAL hdata = nullptr;
+  if (FAILED(stream->Stat(&stat, STATFLAG_NONAME)) ||
+      FAILED(::GetHGlobalFromStream(stream.Get(), &hdata)))
+    return false;
+  base::win::ScopedHGlobal<void*> locked_data(hdata);
+  write(Buffer::Wrap(locked_data.get(),
+                     static_cast<size_t>(stat.cbSize.QuadPart)));
+  return true;
+}
+
+bool Image::PlatformReadPixels(const ReadPixelsCallback& callback) const {
+  Gdiplus::Image* image = const_cast<Gdiplus::Image*>(image_);
+  int width = image->GetWidth();
+  int height = image->GetHeight();
+  Gdiplus::Bitmap bitmap(width, height, PixelFormat32bppARGB);
+  {
+    Gdiplus::Graphics graphics(&bitmap);
+    graphics.SetCompositingMode(Gdiplus::CompositingModeSourceCopy);
+    graphics.DrawImage(image, 0, 0, width, height);
+  }
+  Gdiplus::Rect rect(0, 0, width, height);
+  Gdiplus::BitmapData data;
+  if (bitmap.LockBits(&rect, Gdiplus::ImageLockModeRead, PixelFormat32bppARGB,
+                      &data) != Gdiplus::Ok)
+    return false;
+  // Convert from BGRA to RGBA.
+  std::vector<uint8_t> pixels(width * height * 4);
+  for (int y = 0; y < height; ++y) {
+    const uint8_t* src = static_cast<const uint8_t*>(data.Scan0) +
+                         y * data.Stride;
+    uint8_t* dest = &pixels[y * width * 4];
+    for (int x = 0; x < width * 4; x += 4) {
+      dest[x] = src[x + 2];
+      dest[x + 1] = src[x + 1];
+      dest[x + 2] = src[x];
+      dest[x + 3] = src[x + 3];
+    }
+  }
+  bitmap.UnlockBits(&data);
+  callback(pixels.data(), width, height, width * 4);
+  return true;
+}
+
 bool Image::WriteToFile(const std::string& format,
                         const base::FilePath& target) {
   CLSID encoder;
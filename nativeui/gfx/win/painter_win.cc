@@ -20,6 +20,7 @@
 #include "nativeui/gfx/geometry/size_conversions.h"
 #include "nativeui/gfx/geometry/vector2d_conversions.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
 #include "nativeui/gfx/win/attributed_text_win.h"
 #include "nativeui/gfx/win/double_buffer.h"
 #include "nativeui/state.h"
@@ -171,6 +172,29 @@ void PainterWin::FillRect(const RectF& rect) {
   FillRectPixel(ToEnclosingRect(ScaleRect(rect, scale_factor_)));
 }
 
+void PainterWin::FillPath(const Path* path) {
+  // The path is in DIP, so draw it under scaled transform.
+  auto state = graphics_.Save();
+  graphics_.ScaleTransform(scale_factor_, scale_factor_);
+  Gdiplus::SolidBrush brush(ToGdi(top().fill_color));
+  graphics_.FillPath(&brush, path->GetNative());
+  graphics_.Restore(state);
+  // Should clear current path.
+  use_gdi_current_point_ = true;
+  path_.Reset();
+}
+
+void PainterWin::StrokePath(const Path* path) {
+  auto state = graphics_.Save();
+  graphics_.ScaleTransform(scale_factor_, scale_factor_);
+  Gdiplus::Pen pen(ToGdi(top().stroke_color),
+                   top().line_width / scale_factor_);
+  graphics_.DrawPath(&pen, path->GetNative());
+  graphics_.Restore(state);
+  use_gdi_current_point_ = true;
+  path_.Reset();
+}
+
 void PainterWin::DrawImage(const Image* image, const RectF& rect) {
   graphics_.DrawImage(image->GetNative(),
                       ToGdi(ScaleRect(rect, scale_factor_)));
@@ -212,6 +236,31 @@ void PainterWin::DrawAttributedText(scoped_refptr<AttributedText> text,
       &str->format, str->brush.get());
 }
 
+std::vector<RectF> PainterWin::GetDirtyRects() {
+  // The clip of Graphics does not include the clip of HDC, which is the area
+  // being painted.
+  Gdiplus::RectF visible;
+  graphics_.GetVisibleClipBounds(&visible);
+  Gdiplus::Region clip;
+  graphics_.GetClip(&clip);
+  clip.Intersect(visible);
+  Gdiplus::Matrix matrix;
+  INT count = static_cast<INT>(clip.GetRegionScansCount(&matrix));
+  std::vector<Gdiplus::RectF> scans(count);
+  clip.GetRegionScans(&matrix, scans.data(), &count);
+  std::vector<RectF> rects;
+  for (INT i = 0; i < count; ++i) {
+    const Gdiplus::RectF& scan = scans[i];
+    rects.push_back(ScaleRect(RectF(scan.X, scan.Y, scan.Width, scan.Height),
+                              1.0f / scale_factor_));
+  }
+  return rects;
+}
+
+bool PainterWin::IsRectDirty(const RectF& rect) {
+  return graphics_.IsVisible(ToGdi(ScaleRect(rect, scale_factor_)));
+}
+
 void PainterWin::MoveToPixel(const PointF& point) {
   path_.StartFigure();
   use_gdi_current_point_ = false;
@@ -295,6 +344,10 @@ void PainterWin::FillRectPixel(const nu::Rect& rect) {
   path_.Reset();
 }
 
+void PainterWin::Flush() {
+  graphics_.Flush(Gdiplus::FlushIntentionSync);
+}
+
 void PainterWin::SaveWithSize(SizeF size) {
   SaveWithSize(ToRoundedSize(ScaleSize(size, scale_factor_)));
 }
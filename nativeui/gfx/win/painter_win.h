@@ -8,6 +8,7 @@
 #include <stack>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "nativeui/gfx/painter.h"
 #include "nativeui/gfx/win/gdiplus.h"
@@ -58,6 +59,8 @@ class PainterWin : public Painter {
   void Clear() override;
   void StrokeRect(const RectF& rect) override;
   void FillRect(const RectF& rect) override;
+  void FillPath(const Path* path) override;
+  void StrokePath(const Path* path) override;
   void DrawImage(const Image* image, const RectF& rect) override;
   void DrawImageFromRect(const Image* image, const RectF& src,
                          const RectF& dest) override;
@@ -66,6 +69,8 @@ class PainterWin : public Painter {
                           const RectF& dest) override;
   void DrawAttributedText(scoped_refptr<AttributedText> text,
                           const RectF& rect) override;
+  std::vector<RectF> GetDirtyRects() override;
+  bool IsRectDirty(const RectF& rect) override;
 
   // Internal: The pixel versions.
   void MoveToPixel(const PointF& point);
@@ -81,6 +86,9 @@ class PainterWin : public Painter {
   void StrokeRectPixel(const nu::Rect& rect);
   void FillRectPixel(const nu::Rect& rect);
 
+  // Internal: Finish pending drawing.
+  void Flush();
+
   // Internal: Save with the information of relevant size.
   void SaveWithSize(SizeF size);
   void SaveWithSize(Size size);
@@ -0,0 +1,52 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#include "nativeui/gfx/win/gdiplus.h"
+
+namespace nu {
+
+NativePath Path::PlatformCreate() const {
+  // The path is in DIP, PainterWin scales it when drawing.
+  auto* path = new Gdiplus::GraphicsPath;
+  Gdiplus::PointF start, current;
+  for (size_t i = 0; i < data_.size();) {
+    const float* f = data_.data() + i + 1;
+    switch (static_cast<Command>(data_[i])) {
+      case Command::MoveTo:
+        path->StartFigure();
+        start = current = Gdiplus::PointF(f[0], f[1]);
+        i += 3;
+        break;
+      case Command::LineTo:
+        path->AddLine(current, Gdiplus::PointF(f[0], f[1]));
+        current = Gdiplus::PointF(f[0], f[1]);
+        i += 3;
+        break;
+      case Command::BezierCurveTo:
+        path->AddBezier(current,
+                        Gdiplus::PointF(f[0], f[1]),
+                        Gdiplus::PointF(f[2], f[3]),
+                        Gdiplus::PointF(f[4], f[5]));
+        current = Gdiplus::PointF(f[4], f[5]);
+        i += 7;
+        break;
+      default:
+        path->CloseFigure();
+        // Closing a figure moves current point to the start of it.
+        current = start;
+        i += 1;
+        break;
+    }
+  }
+  return path;
+}
+
+// static
+void Path::PlatformDestroy(NativePath path) {
+  delete path;
+}
+
+}  // namespace nu
@@ -57,10 +57,13 @@ void Container::PlatformAddChildView(View* child) {
   }
 
   gtk_container_add(GTK_CONTAINER(GetNative()), child->GetNative());
+  // Update cached bitmaps of the subtree.
+  SchedulePaint();
 }
 
 void Container::PlatformRemoveChildView(View* child) {
   gtk_container_remove(GTK_CONTAINER(GetNative()), child->GetNative());
+  SchedulePaint();
 }
 
 }  // namespace nu
@@ -163,9 +163,13 @@ static gboolean nu_container_draw(GtkWidget* widget, cairo_t* cr) {
   gtk_render_background(gtk_widget_get_style_context(widget), cr,
                         0, 0, width, height);
 
+  GdkRectangle clip;
+  RectF dirty = gdk_cairo_get_clip_rectangle(cr, &clip) ?
+      RectF(Rect(clip)) : RectF(0, 0, width, height);
+
   Container* delegate = NU_CONTAINER(widget)->priv->delegate;
   PainterGtk painter(cr, SizeF(width, height));
-  delegate->on_draw.Emit(delegate, &painter, nu::RectF(0, 0, width, height));
+  delegate->Draw(&painter, dirty);
 
   for (int i = 0; i < delegate->ChildCount(); ++i)
     gtk_container_propagate_draw(GTK_CONTAINER(widget),
@@ -4,7 +4,10 @@
 
 #include "nativeui/state.h"
 
+#include "nativeui/gfx/gtk/glyph_atlas.h"
 #include "nativeui/gfx/gtk/gtk_theme.h"
+#include "nativeui/gfx/gtk/surface_pool.h"
+#include "nativeui/gfx/gtk/text_shaper.h"
 
 namespace nu {
 
@@ -17,4 +20,22 @@ GtkTheme* State::GetGtkTheme() {
   return gtk_theme_.get();
 }
 
+TextShaper* State::GetTextShaper() {
+  if (!text_shaper_)
+    text_shaper_.reset(new TextShaper);
+  return text_shaper_.get();
+}
+
+GlyphAtlas* State::GetGlyphAtlas() {
+  if (!glyph_atlas_)
+    glyph_atlas_.reset(new GlyphAtlas);
+  return glyph_atlas_.get();
+}
+
+SurfacePool* State::GetSurfacePool() {
+  if (!surface_pool_)
+    surface_pool_.reset(new SurfacePool);
+  return surface_pool_.get();
+}
+
 }  // namespace nu
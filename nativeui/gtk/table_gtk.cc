@@ -4,6 +4,8 @@
 
 #include "nativeui/table.h"
 
+#include <utility>
+
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "base/values.h"
@@ -287,6 +289,52 @@ void Table::NotifyRowInsertion(uint32_t row) {
   gtk_tree_path_free(tree_path);
 }
 
+void Table::NotifyRowsInsertion(uint32_t row, uint32_t count) {
+  // GtkTreeView handles row-inserted one by one, which is very slow for large
+  // amount of rows, it is much faster to just let it reload the whole model.
+  if (count < 64) {
+    for (uint32_t i = 0; i < count; ++i)
+      NotifyRowInsertion(row + i);
+    return;
+  }
+  auto* tree_view = GTK_TREE_VIEW(g_object_get_data(G_OBJECT(GetNative()),
+                                                    "widget"));
+  auto* tree_model = gtk_tree_view_get_model(tree_view);
+  if (!tree_model)
+    return;
+  // Reloading resets the selection and scroll position, restore them with
+  // the indices moved by the inserted rows.
+  auto shift = [row, count](int index) {
+    return index >= static_cast<int>(row) ? index + static_cast<int>(count)
+                                          : index;
+  };
+  std::set<int> selected_rows;
+  for (int selected : GetSelectedRows())
+    selected_rows.insert(shift(selected));
+  GtkTreePath* top_path = nullptr;
+  if (gtk_widget_get_realized(GTK_WIDGET(tree_view)))
+    gtk_tree_view_get_visible_range(tree_view, &top_path, nullptr);
+  GtkAdjustment* hadjustment =
+      gtk_scrollable_get_hadjustment(GTK_SCROLLABLE(tree_view));
+  double scroll_x = hadjustment ? gtk_adjustment_get_value(hadjustment) : 0;
+  g_object_ref(tree_model);
+  gtk_tree_view_set_model(tree_view, nullptr);
+  gtk_tree_view_set_model(tree_view, tree_model);
+  g_object_unref(tree_model);
+  SelectRows(std::move(selected_rows));
+  if (top_path) {
+    // The scrolling is deferred until the rows are measured, and keeps the
+    // same row at top like inserting rows one by one.
+    GtkTreePath* path = gtk_tree_path_new_from_indices(
+        shift(gtk_tree_path_get_indices(top_path)[0]), -1);
+    gtk_tree_view_scroll_to_cell(tree_view, path, nullptr, TRUE, 0, 0);
+    gtk_tree_path_free(path);
+    gtk_tree_path_free(top_path);
+  }
+  if (hadjustment)
+    gtk_adjustment_set_value(hadjustment, scroll_x);
+}
+
 void Table::NotifyRowDeletion(uint32_t row) {
   auto* tree_view = GTK_TREE_VIEW(g_object_get_data(G_OBJECT(GetNative()),
                                                     "widget"));
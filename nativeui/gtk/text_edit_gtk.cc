@@ -7,6 +7,8 @@
 #include <gdk/gdkkeysyms.h>
 #include <gtk/gtk.h>
 
+#include <cstdlib>
+
 #include "nativeui/gfx/attributed_text.h"
 #include "nativeui/gfx/font.h"
 #include "nativeui/gtk/util/undoable_text_buffer.h"
@@ -30,6 +32,45 @@ void OnTextChange(GtkTextBuffer* buffer, TextEdit* edit) {
     edit->on_text_change.Emit(edit);
 }
 
+// The |location| has been moved to the end of inserted text.
+void OnInsertTextAfter(GtkTextBuffer* buffer,
+                       GtkTextIter* location,
+                       gchar* text,
+                       gint len,
+                       TextEdit* edit) {
+  if (edit->on_text_delta.IsEmpty() || edit->IsLoading())
+    return;
+  TextEdit::TextDelta delta;
+  delta.offset = gtk_text_iter_get_offset(location) -
+                 g_utf8_strlen(text, len);
+  delta.inserted_text.assign(text, len);
+  edit->on_text_delta.Emit(edit, delta);
+}
+
+// Both iters point to the same place after deletion, so the range has to be
+// recorded before deletion.
+void OnDeleteRange(GtkTextBuffer* buffer,
+                   GtkTextIter* start,
+                   GtkTextIter* end,
+                   TextEdit* edit) {
+  int length = gtk_text_iter_get_offset(end) - gtk_text_iter_get_offset(start);
+  g_object_set_data(G_OBJECT(buffer), "deleted-length",
+                    GINT_TO_POINTER(std::abs(length)));
+}
+
+void OnDeleteRangeAfter(GtkTextBuffer* buffer,
+                        GtkTextIter* start,
+                        GtkTextIter* end,
+                        TextEdit* edit) {
+  if (edit->on_text_delta.IsEmpty() || edit->IsLoading())
+    return;
+  TextEdit::TextDelta delta;
+  delta.offset = gtk_text_iter_get_offset(start);
+  delta.deleted_length = GPOINTER_TO_INT(
+      g_object_get_data(G_OBJECT(buffer), "deleted-length"));
+  edit->on_text_delta.Emit(edit, delta);
+}
+
 gboolean OnKeyPress(GtkWidget*, GdkEventKey* event, TextEdit* edit) {
   if (event->type == GDK_KEY_PRESS && event->keyval == GDK_KEY_Return &&
       edit->should_insert_new_line)
@@ -53,12 +94,18 @@ TextEdit::TextEdit() {
   GtkTextBuffer* buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(text_view));
   TextBufferMakeUndoable(buffer);
   g_signal_connect(buffer, "changed", G_CALLBACK(OnTextChange), this);
+  g_signal_connect_after(buffer, "insert-text",
+                         G_CALLBACK(OnInsertTextAfter), this);
+  g_signal_connect(buffer, "delete-range", G_CALLBACK(OnDeleteRange), this);
+  g_signal_connect_after(buffer, "delete-range",
+                         G_CALLBACK(OnDeleteRangeAfter), this);
 }
 
 TextEdit::~TextEdit() {
 }
 
 void TextEdit::SetText(const std::string& text) {
+  CancelLoad();
   GtkTextBuffer* buffer = gtk_text_view_get_buffer(
       GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget")));
   g_object_set_data(G_OBJECT(buffer), "is-editing", this);
@@ -78,6 +125,34 @@ std::string TextEdit::GetText() const {
   return result;
 }
 
+void TextEdit::PlatformBeginLoad() {
+  auto* text_view =
+      GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget"));
+  read_only_before_load_ = !gtk_text_view_get_editable(text_view);
+  gtk_text_view_set_editable(text_view, false);
+  GtkTextBuffer* buffer = gtk_text_view_get_buffer(text_view);
+  TextBufferBeginNotUndoableAction(buffer);
+  g_object_set_data(G_OBJECT(buffer), "is-editing", this);
+  gtk_text_buffer_set_text(buffer, "", 0);
+}
+
+void TextEdit::PlatformAppendText(const char* text, size_t length) {
+  GtkTextBuffer* buffer = gtk_text_view_get_buffer(
+      GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget")));
+  GtkTextIter end_iter;
+  gtk_text_buffer_get_end_iter(buffer, &end_iter);
+  gtk_text_buffer_insert(buffer, &end_iter, text, length);
+}
+
+void TextEdit::PlatformEndLoad() {
+  auto* text_view =
+      GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget"));
+  GtkTextBuffer* buffer = gtk_text_view_get_buffer(text_view);
+  g_object_set_data(G_OBJECT(buffer), "is-editing", nullptr);
+  TextBufferEndNotUndoableAction(buffer);
+  gtk_text_view_set_editable(text_view, !read_only_before_load_);
+}
+
 void TextEdit::Redo() {
   GtkTextBuffer* buffer = gtk_text_view_get_buffer(
       GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget")));
@@ -102,6 +177,18 @@ bool TextEdit::CanUndo() const {
   return TextBufferCanUndo(buffer);
 }
 
+void TextEdit::SetUndoLimits(size_t max_bytes, size_t max_groups) {
+  GtkTextBuffer* buffer = gtk_text_view_get_buffer(
+      GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget")));
+  TextBufferSetUndoLimits(buffer, max_bytes, max_groups);
+}
+
+size_t TextEdit::GetUndoMemoryUsage() const {
+  GtkTextBuffer* buffer = gtk_text_view_get_buffer(
+      GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget")));
+  return TextBufferGetUndoMemoryUsage(buffer);
+}
+
 void TextEdit::Cut() {
   GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
   GtkTextBuffer* buffer = gtk_text_view_get_buffer(
@@ -153,15 +240,34 @@ void TextEdit::SelectRange(int start, int end) {
 }
 
 std::string TextEdit::GetTextInRange(int start, int end) const {
+  std::string result;
+  ReadRange(start, end, &result);
+  return result;
+}
+
+void TextEdit::ReadRange(int start, int end, std::string* out) const {
   GtkTextBuffer* buffer = gtk_text_view_get_buffer(
       GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget")));
-  GtkTextIter start_iter, end_iter;
-  gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, start);
+  GtkTextIter iter, end_iter;
+  gtk_text_buffer_get_iter_at_offset(buffer, &iter, start);
   gtk_text_buffer_get_iter_at_offset(buffer, &end_iter, end);
-  char* text = gtk_text_buffer_get_text(buffer, &start_iter, &end_iter, false);
-  std::string result(text);
-  g_free(text);
-  return result;
+  gtk_text_iter_order(&iter, &end_iter);
+  // Write the characters into |out| directly, so reading chunks of a large
+  // buffer reuses the string's memory instead of allocating a copy.
+  out->clear();
+  out->reserve(gtk_text_iter_get_offset(&end_iter) -
+               gtk_text_iter_get_offset(&iter));
+  char utf8[6];
+  while (gtk_text_iter_compare(&iter, &end_iter) < 0) {
+    out->append(utf8, g_unichar_to_utf8(gtk_text_iter_get_char(&iter), utf8));
+    gtk_text_iter_forward_char(&iter);
+  }
+}
+
+int TextEdit::GetTextLength() const {
+  GtkTextBuffer* buffer = gtk_text_view_get_buffer(
+      GTK_TEXT_VIEW(g_object_get_data(G_OBJECT(GetNative()), "widget")));
+  return gtk_text_buffer_get_char_count(buffer);
 }
 
 void TextEdit::InsertText(const std::string& text) {
@@ -6,56 +6,37 @@
 
 #include <gtk/gtk.h>
 
-#include <stack>
-#include <string>
-#include <utility>
+#include <vector>
 
 #include "nativeui/gtk/util/widget_util.h"
+#include "nativeui/util/undo_journal.h"
 
 namespace nu {
 
 namespace {
 
-// Insert or Delete.
-enum ActionType {
-  INSERT,
-  DELETE,
+// A structure holding the undo journal.
+struct UndoableData {
+  UndoJournal journal;
+  std::vector<UndoJournal::Edit> edits;
+  bool ignore_events = false;
 };
 
-// An undoable action.
-struct UndoableAction {
-  // Insert action.
-  UndoableAction(GtkTextIter* iter, std::string&& text)
-      : type(INSERT), start(gtk_text_iter_get_offset(iter)), text(text) {}
-
-  // Delete action.
-  UndoableAction(GtkTextBuffer* buffer,
-                 GtkTextIter* start_iter,
-                 GtkTextIter* end_iter)
-      : type(DELETE),
-        start(gtk_text_iter_get_offset(start_iter)),
-        end(gtk_text_iter_get_offset(end_iter)),
-        text(gtk_text_buffer_get_text(buffer, start_iter, end_iter, TRUE)) {
-    // Whether it is Delete or Backspace key.
-    GtkTextIter insert_iter;
-    gtk_text_buffer_get_iter_at_mark(buffer, &insert_iter,
-                                     gtk_text_buffer_get_insert(buffer));
-    is_delete = gtk_text_iter_get_offset(&insert_iter) <= start;
-  }
+UndoableData* GetData(GtkTextBuffer* buffer) {
+  return static_cast<UndoableData*>(
+      g_object_get_data(G_OBJECT(buffer), "undoable-data"));
+}
 
-  ActionType type;
-  int start;
-  int end;  // only used by delete action
-  std::string text;
-  bool is_delete;
-};
+// Each user action, like typing a character or pasting, is an undo group.
+void OnBeginUserAction(GtkTextBuffer* buffer, UndoableData* data) {
+  if (!data->ignore_events)
+    data->journal.BeginGroup();
+}
 
-// A structure holding the undo and redo stacks.
-struct UndoableData {
-  std::stack<UndoableAction> undo_stack;
-  std::stack<UndoableAction> redo_stack;
-  bool ignore_events = false;
-};
+void OnEndUserAction(GtkTextBuffer* buffer, UndoableData* data) {
+  if (!data->ignore_events)
+    data->journal.EndGroup();
+}
 
 void OnInsertText(GtkTextBuffer* buffer,
                   GtkTextIter* iter,
@@ -63,8 +44,9 @@ void OnInsertText(GtkTextBuffer* buffer,
                   UndoableData* data) {
   if (data->ignore_events)
     return;
-  data->redo_stack = std::stack<UndoableAction>();
-  data->undo_stack.emplace(iter, std::string(text, length));
+  data->journal.RecordInsert(gtk_text_iter_get_offset(iter),
+                             base::StringPiece(text, length),
+                             g_utf8_strlen(text, length));
 }
 
 void OnDeleteRange(GtkTextBuffer* buffer,
@@ -73,8 +55,16 @@ void OnDeleteRange(GtkTextBuffer* buffer,
                    UndoableData* data) {
   if (data->ignore_events)
     return;
-  data->redo_stack = std::stack<UndoableAction>();
-  data->undo_stack.emplace(buffer, start_iter, end_iter);
+  int start = gtk_text_iter_get_offset(start_iter);
+  int end = gtk_text_iter_get_offset(end_iter);
+  // Whether it is Delete or Backspace key.
+  GtkTextIter insert_iter;
+  gtk_text_buffer_get_iter_at_mark(buffer, &insert_iter,
+                                   gtk_text_buffer_get_insert(buffer));
+  bool is_delete_key = gtk_text_iter_get_offset(&insert_iter) <= start;
+  char* text = gtk_text_buffer_get_text(buffer, start_iter, end_iter, TRUE);
+  data->journal.RecordDelete(start, text, end - start, is_delete_key);
+  g_free(text);
 }
 
 }  // namespace
@@ -83,6 +73,10 @@ void TextBufferMakeUndoable(GtkTextBuffer* buffer) {
   UndoableData* data = new UndoableData;
   g_object_set_data_full(G_OBJECT(buffer), "undoable-data", data,
                          Delete<UndoableData>);
+  g_signal_connect(buffer, "begin-user-action",
+                   G_CALLBACK(OnBeginUserAction), data);
+  g_signal_connect(buffer, "end-user-action",
+                   G_CALLBACK(OnEndUserAction), data);
   g_signal_connect(buffer, "insert-text", G_CALLBACK(OnInsertText), data);
   g_signal_connect(buffer, "delete-range", G_CALLBACK(OnDeleteRange), data);
 }
@@ -92,80 +86,88 @@ bool TextBufferIsUndoable(GtkTextBuffer* buffer) {
 }
 
 void TextBufferUndo(GtkTextBuffer* buffer) {
-  auto* data = static_cast<UndoableData*>(
-      g_object_get_data(G_OBJECT(buffer), "undoable-data"));
-  if (data->undo_stack.empty())
+  UndoableData* data = GetData(buffer);
+  if (!data->journal.Undo(&data->edits))
     return;
 
-  UndoableAction undo_action = std::move(data->undo_stack.top());
-  data->undo_stack.pop();
-
   data->ignore_events = true;
-  if (undo_action.type == INSERT) {
+  for (auto it = data->edits.rbegin(); it != data->edits.rend(); ++it) {
     GtkTextIter start_iter, end_iter;
-    gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, undo_action.start);
-    gtk_text_buffer_get_iter_at_offset(
-        buffer, &end_iter, undo_action.start + undo_action.text.length());
-    gtk_text_buffer_delete(buffer, &start_iter, &end_iter);
-    gtk_text_buffer_place_cursor(buffer, &start_iter);
-  } else {
-    GtkTextIter start_iter;
-    gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, undo_action.start);
-    gtk_text_buffer_insert(buffer, &start_iter,
-                           undo_action.text.data(), undo_action.text.length());
-    if (undo_action.is_delete) {
+    gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, it->offset);
+    if (it->type == UndoJournal::Type::Insert) {
+      gtk_text_buffer_get_iter_at_offset(buffer, &end_iter,
+                                         it->offset + it->length);
+      gtk_text_buffer_delete(buffer, &start_iter, &end_iter);
       gtk_text_buffer_place_cursor(buffer, &start_iter);
     } else {
-      GtkTextIter end_iter;
-      gtk_text_buffer_get_iter_at_offset(buffer, &end_iter, undo_action.end);
-      gtk_text_buffer_place_cursor(buffer, &end_iter);
+      gtk_text_buffer_insert(buffer, &start_iter,
+                             it->text.data(), it->text.size());
+      if (it->is_delete_key) {
+        gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, it->offset);
+        gtk_text_buffer_place_cursor(buffer, &start_iter);
+      } else {
+        gtk_text_buffer_get_iter_at_offset(buffer, &end_iter,
+                                           it->offset + it->length);
+        gtk_text_buffer_place_cursor(buffer, &end_iter);
+      }
     }
   }
   data->ignore_events = false;
-
-  data->redo_stack.push(std::move(undo_action));
 }
 
 bool TextBufferCanUndo(GtkTextBuffer* buffer) {
-  auto* data = static_cast<UndoableData*>(
-      g_object_get_data(G_OBJECT(buffer), "undoable-data"));
-  return !data->undo_stack.empty();
+  return GetData(buffer)->journal.CanUndo();
 }
 
 void TextBufferRedo(GtkTextBuffer* buffer) {
-  auto* data = static_cast<UndoableData*>(
-      g_object_get_data(G_OBJECT(buffer), "undoable-data"));
-  if (data->redo_stack.empty())
+  UndoableData* data = GetData(buffer);
+  if (!data->journal.Redo(&data->edits))
     return;
 
-  UndoableAction redo_action = std::move(data->redo_stack.top());
-  data->redo_stack.pop();
-
   data->ignore_events = true;
-  if (redo_action.type == INSERT) {
+  for (const UndoJournal::Edit& edit : data->edits) {
     GtkTextIter start_iter, end_iter;
-    gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, redo_action.start);
-    gtk_text_buffer_insert(buffer, &start_iter,
-                           redo_action.text.data(), redo_action.text.length());
-    gtk_text_buffer_get_iter_at_offset(
-        buffer, &end_iter, redo_action.start + redo_action.text.length());
-    gtk_text_buffer_place_cursor(buffer, &end_iter);
-  } else {
-    GtkTextIter start_iter, end_iter;
-    gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, redo_action.start);
-    gtk_text_buffer_get_iter_at_offset(buffer, &end_iter, redo_action.end);
-    gtk_text_buffer_delete(buffer, &start_iter, &end_iter);
-    gtk_text_buffer_place_cursor(buffer, &start_iter);
+    gtk_text_buffer_get_iter_at_offset(buffer, &start_iter, edit.offset);
+    if (edit.type == UndoJournal::Type::Insert) {
+      gtk_text_buffer_insert(buffer, &start_iter,
+                             edit.text.data(), edit.text.size());
+      gtk_text_buffer_get_iter_at_offset(buffer, &end_iter,
+                                         edit.offset + edit.length);
+      gtk_text_buffer_place_cursor(buffer, &end_iter);
+    } else {
+      gtk_text_buffer_get_iter_at_offset(buffer, &end_iter,
+                                         edit.offset + edit.length);
+      gtk_text_buffer_delete(buffer, &start_iter, &end_iter);
+      gtk_text_buffer_place_cursor(buffer, &start_iter);
+    }
   }
   data->ignore_events = false;
-
-  data->undo_stack.emplace(std::move(redo_action));
 }
 
 bool TextBufferCanRedo(GtkTextBuffer* buffer) {
-  auto* data = static_cast<UndoableData*>(
-      g_object_get_data(G_OBJECT(buffer), "undoable-data"));
-  return !data->redo_stack.empty();
+  return GetData(buffer)->journal.CanRedo();
+}
+
+void TextBufferBeginNotUndoableAction(GtkTextBuffer* buffer) {
+  UndoableData* data = GetData(buffer);
+  data->journal.Clear();
+  data->ignore_events = true;
+}
+
+void TextBufferEndNotUndoableAction(GtkTextBuffer* buffer) {
+  UndoableData* data = GetData(buffer);
+  data->ignore_events = false;
+  data->journal.Clear();
+}
+
+void TextBufferSetUndoLimits(GtkTextBuffer* buffer,
+                             size_t max_bytes,
+                             size_t max_groups) {
+  GetData(buffer)->journal.SetLimits(max_bytes, max_groups);
+}
+
+size_t TextBufferGetUndoMemoryUsage(GtkTextBuffer* buffer) {
+  return GetData(buffer)->journal.GetMemoryUsage();
 }
 
 }  // namespace nu
@@ -5,6 +5,8 @@
 #ifndef NATIVEUI_GTK_UTIL_UNDOABLE_TEXT_BUFFER_H_
 #define NATIVEUI_GTK_UTIL_UNDOABLE_TEXT_BUFFER_H_
 
+#include <stddef.h>
+
 typedef struct _GtkTextBuffer GtkTextBuffer;
 
 namespace nu {
@@ -19,6 +21,17 @@ bool TextBufferCanUndo(GtkTextBuffer* buffer);
 void TextBufferRedo(GtkTextBuffer* buffer);
 bool TextBufferCanRedo(GtkTextBuffer* buffer);
 
+// Changes between the calls are not recorded, and the undo/redo stacks are
+// cleared when the action ends.
+void TextBufferBeginNotUndoableAction(GtkTextBuffer* buffer);
+void TextBufferEndNotUndoableAction(GtkTextBuffer* buffer);
+
+// Limit the memory used by the undo history.
+void TextBufferSetUndoLimits(GtkTextBuffer* buffer,
+                             size_t max_bytes,
+                             size_t max_groups);
+size_t TextBufferGetUndoMemoryUsage(GtkTextBuffer* buffer);
+
 }  // namespace nu
 
 #endif  // NATIVEUI_GTK_UTIL_UNDOABLE_TEXT_BUFFER_H_
@@ -13,10 +13,14 @@
 #include "nativeui/gfx/geometry/point_f.h"
 #include "nativeui/gfx/geometry/rect_conversions.h"
 #include "nativeui/gfx/geometry/rect_f.h"
+#include "nativeui/gfx/gtk/surface_pool.h"
+#include "nativeui/gif_player.h"
 #include "nativeui/gtk/dragging_info_gtk.h"
 #include "nativeui/gtk/nu_container.h"
 #include "nativeui/gtk/util/clipboard_util.h"
 #include "nativeui/gtk/util/widget_util.h"
+#include "nativeui/label.h"
+#include "nativeui/state.h"
 #include "nativeui/window.h"
 
 namespace nu {
@@ -46,8 +50,98 @@ struct NUViewPrivate {
   int drag_operation = -1;
   // The drag data.
   std::vector<Clipboard::Data> drag_data;
+
+  // Whether the view and its children are drawn from a cached bitmap.
+  bool cache_as_bitmap = false;
+  bool rendering_cache = false;
+  gulong draw_handler = 0;
+  cairo_surface_t* cached_bitmap = nullptr;
+  // The last bounds in parent, used for detecting layout changes.
+  Rect bounds;
+
+  ~NUViewPrivate();
 };
 
+// Number of views that have cached bitmaps, invalidation is skipped when there
+// is none.
+int g_cache_as_bitmap_count = 0;
+
+NUViewPrivate::~NUViewPrivate() {
+  if (cache_as_bitmap)
+    g_cache_as_bitmap_count--;
+  if (cached_bitmap)
+    cairo_surface_destroy(cached_bitmap);
+}
+
+NUViewPrivate* GetViewPrivate(GtkWidget* widget) {
+  return static_cast<NUViewPrivate*>(
+      g_object_get_data(G_OBJECT(widget), "private"));
+}
+
+// Drop the cached bitmaps of |view| and its ancestors.
+void InvalidateCachedBitmaps(View* view) {
+  if (g_cache_as_bitmap_count == 0)
+    return;
+  for (; view; view = view->GetParent()) {
+    NUViewPrivate* priv = GetViewPrivate(view->GetNative());
+    if (priv && priv->cached_bitmap) {
+      cairo_surface_destroy(priv->cached_bitmap);
+      priv->cached_bitmap = nullptr;
+    }
+  }
+}
+
+// Whether there are views drawn by GTK in the subtree of |view|. Native
+// widgets can redraw themselves without going through the view APIs, for
+// example when hovered or typed into, which can not invalidate the cache.
+// GifPlayer draws itself and calls SchedulePaint on each frame.
+bool HasNativeWidgets(View* view) {
+  if (view->GetClassName() == Label::kClassName ||
+      view->GetClassName() == GifPlayer::kClassName)
+    return false;
+  if (!view->IsContainer())
+    return true;
+  auto* container = static_cast<Container*>(view);
+  for (int i = 0; i < container->ChildCount(); ++i) {
+    if (HasNativeWidgets(container->ChildAt(i)))
+      return true;
+  }
+  return false;
+}
+
+// Draw the view from cached bitmap, and stop other handlers from drawing.
+gboolean OnDrawCachedBitmap(GtkWidget* widget, cairo_t* cr,
+                            NUViewPrivate* priv) {
+  // Let the view draw itself when rendering into the cache.
+  if (priv->rendering_cache)
+    return FALSE;
+  // Adding children drops the cache, so the subtree only needs checking
+  // before rendering the cache.
+  if (!priv->cached_bitmap && HasNativeWidgets(priv->delegate))
+    return FALSE;
+  int scale = gtk_widget_get_scale_factor(widget);
+  int width = gtk_widget_get_allocated_width(widget) * scale;
+  int height = gtk_widget_get_allocated_height(widget) * scale;
+  if (priv->cached_bitmap &&
+      (cairo_image_surface_get_width(priv->cached_bitmap) != width ||
+       cairo_image_surface_get_height(priv->cached_bitmap) != height)) {
+    cairo_surface_destroy(priv->cached_bitmap);
+    priv->cached_bitmap = nullptr;
+  }
+  if (!priv->cached_bitmap) {
+    priv->cached_bitmap = State::GetCurrent()->GetSurfacePool()->CreateSurface(
+        width, height, scale);
+    cairo_t* context = cairo_create(priv->cached_bitmap);
+    priv->rendering_cache = true;
+    gtk_widget_draw(widget, context);
+    priv->rendering_cache = false;
+    cairo_destroy(context);
+  }
+  cairo_set_source_surface(cr, priv->cached_bitmap, 0, 0);
+  cairo_paint(cr);
+  return TRUE;
+}
+
 // Helper to set cursor for view.
 void NUSetCursor(GtkWidget* widget, GdkCursor* cursor) {
   GdkWindow* window = NU_IS_CONTAINER(widget) ?
@@ -75,6 +169,21 @@ void OnSizeAllocate(GtkWidget* widget, GdkRectangle* allocation,
       allocation->width == 1 && allocation->height == 1)
     return;
 
+  // Moving or resizing children changes the content of parents. The
+  // allocation is relative to window, so compare the bounds in parent.
+  View* parent = priv->delegate->GetParent();
+  if (g_cache_as_bitmap_count > 0 && parent) {
+    GdkRectangle parent_allocation;
+    gtk_widget_get_allocation(parent->GetNative(), &parent_allocation);
+    Rect bounds(allocation->x - parent_allocation.x,
+                allocation->y - parent_allocation.y,
+                allocation->width, allocation->height);
+    if (bounds != priv->bounds) {
+      priv->bounds = bounds;
+      InvalidateCachedBitmaps(parent);
+    }
+  }
+
   // Size allocation happens unnecessarily often.
   Size size(allocation->width, allocation->height);
   if (size != priv->size) {
@@ -324,16 +433,21 @@ Rect View::GetPixelBounds() const {
 }
 
 void View::SchedulePaint() {
+  OnSchedulePaint();
+  InvalidateCachedBitmaps(this);
   gtk_widget_queue_draw(view_);
 }
 
 void View::SchedulePaintRect(const RectF& rect) {
+  OnSchedulePaint();
+  InvalidateCachedBitmaps(this);
   gtk_widget_queue_draw_area(view_,
                              rect.x(), rect.y(), rect.width(), rect.height());
 }
 
 void View::PlatformSetVisible(bool visible) {
   gtk_widget_set_visible(view_, visible);
+  InvalidateCachedBitmaps(GetParent());
 }
 
 bool View::IsVisible() const {
@@ -387,6 +501,43 @@ bool View::IsMouseDownCanMoveWindow() const {
   return g_object_get_data(G_OBJECT(view_), "draggable");
 }
 
+void View::SetOpacity(float opacity) {
+  gtk_widget_set_opacity(view_, opacity);
+}
+
+float View::GetOpacity() const {
+  return gtk_widget_get_opacity(view_);
+}
+
+void View::SetCacheAsBitmap(bool cache) {
+  NUViewPrivate* priv = GetViewPrivate(view_);
+  if (priv->cache_as_bitmap == cache)
+    return;
+  priv->cache_as_bitmap = cache;
+  if (cache) {
+    g_cache_as_bitmap_count++;
+    priv->draw_handler = g_signal_connect(
+        view_, "draw", G_CALLBACK(OnDrawCachedBitmap), priv);
+  } else {
+    g_cache_as_bitmap_count--;
+    g_signal_handler_disconnect(view_, priv->draw_handler);
+    priv->draw_handler = 0;
+    if (priv->cached_bitmap) {
+      cairo_surface_destroy(priv->cached_bitmap);
+      priv->cached_bitmap = nullptr;
+    }
+  }
+  gtk_widget_queue_draw(view_);
+}
+
+bool View::IsCacheAsBitmap() const {
+  return GetViewPrivate(view_)->cache_as_bitmap;
+}
+
+bool View::HasCachedBitmap() const {
+  return GetViewPrivate(view_)->cached_bitmap;
+}
+
 int View::DoDragWithOptions(std::vector<Clipboard::Data> objects,
                             int operations,
                             const DragOptions& options) {
@@ -0,0 +1,43 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <algorithm>
+#include <iostream>
+
+#include "base/files/file_path.h"
+#include "base/path_service.h"
+#include "base/timer/elapsed_timer.h"
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class ImagePerfTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    base::FilePath exe_path;
+    base::PathService::Get(base::FILE_EXE, &exe_path);
+    base::FilePath dir = exe_path.DirName().DirName().DirName()
+                                 .Append(FILE_PATH_LITERAL("nativeui"))
+                                 .Append(FILE_PATH_LITERAL("test"))
+                                 .Append(FILE_PATH_LITERAL("fixtures"));
+    static_img_ = new nu::Image(dir.Append(FILE_PATH_LITERAL("static.png")));
+  }
+
+  nu::State state_;
+  scoped_refptr<nu::Image> static_img_;
+};
+
+TEST_F(ImagePerfTest, TintAndResizeIcons) {
+  const int kIconCount = 500;
+  scoped_refptr<nu::Image> icon = static_img_->Resize(nu::SizeF(64, 64), 1);
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kIconCount; ++i) {
+    scoped_refptr<nu::Image> tinted = icon->Tint(nu::Color(i % 256, 0, 0));
+    scoped_refptr<nu::Image> resized = tinted->Resize(nu::SizeF(24, 24), 1);
+  }
+  base::TimeDelta elapsed = timer.Elapsed();
+  std::cout << "Tinting and resizing " << kIconCount << " icons of 64x64: "
+            << elapsed.InMilliseconds() << "ms, "
+            << kIconCount / std::max(elapsed.InSecondsF(), 0.001)
+            << " icons/s" << std::endl;
+}
@@ -2,11 +2,22 @@
 // Use of this source code is governed by the license that can be found in the
 // LICENSE file.
 
+#include <string>
+#include <vector>
+
 #include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
 #include "base/path_service.h"
 #include "nativeui/nativeui.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+#if defined(OS_LINUX)
+#include <gtk/gtk.h>
+
+#include "nativeui/gfx/gtk/image_kernels.h"
+#endif
+
 class ImageTest : public testing::Test {
  protected:
   void SetUp() override {
@@ -18,11 +29,17 @@ class ImageTest : public testing::Test {
                                  .Append(FILE_PATH_LITERAL("fixtures"));
     static_img_ = new nu::Image(dir.Append(FILE_PATH_LITERAL("static.png")));
     hidpi_img_ = new nu::Image(dir.Append(FILE_PATH_LITERAL("hidpi@2x.png")));
+    animated_img_ =
+        new nu::Image(dir.Append(FILE_PATH_LITERAL("animated.gif")));
+    repeated_img_ =
+        new nu::Image(dir.Append(FILE_PATH_LITERAL("repeated.gif")));
   }
 
   nu::State state_;
   scoped_refptr<nu::Image> static_img_;
   scoped_refptr<nu::Image> hidpi_img_;
+  scoped_refptr<nu::Image> animated_img_;
+  scoped_refptr<nu::Image> repeated_img_;
 };
 
 TEST_F(ImageTest, HiDPI) {
@@ -50,3 +67,156 @@ TEST_F(ImageTest, ToJPEG) {
   EXPECT_EQ(jpg->GetSize(), nu::SizeF(10, 10));
   EXPECT_EQ(jpg->GetScaleFactor(), 1);
 }
+
+TEST_F(ImageTest, Encode) {
+  std::string data;
+  int chunks = 0;
+  auto write = [&](const nu::Buffer& chunk) {
+    data.append(static_cast<char*>(chunk.content()), chunk.size());
+    ++chunks;
+  };
+  nu::Image::EncodeOptions options;
+  options.compression = 1;
+  ASSERT_TRUE(hidpi_img_->Encode(options, write));
+  EXPECT_GT(chunks, 0);
+  scoped_refptr<nu::Image> png = new nu::Image(
+      nu::Buffer::Wrap(data.data(), data.size()), 1);
+  EXPECT_EQ(png->GetSize(), nu::SizeF(10, 10));
+
+  data.clear();
+  options.format = nu::Image::Format::JPEG;
+  options.quality = 80;
+  options.progressive = true;
+  ASSERT_TRUE(hidpi_img_->Encode(options, write));
+  scoped_refptr<nu::Image> jpg = new nu::Image(
+      nu::Buffer::Wrap(data.data(), data.size()), 1);
+  EXPECT_EQ(jpg->GetSize(), nu::SizeF(10, 10));
+
+  data.clear();
+  options.format = nu::Image::Format::QOI;
+  ASSERT_TRUE(hidpi_img_->Encode(options, write));
+  ASSERT_GE(data.size(), 22u);
+  EXPECT_EQ(data.substr(0, 4), "qoif");
+  EXPECT_EQ(data.substr(4, 8), std::string("\0\0\0\x0a\0\0\0\x0a", 8));
+  EXPECT_EQ(data.substr(data.size() - 8), std::string("\0\0\0\0\0\0\0\x01", 8));
+
+  scoped_refptr<nu::Image> empty = new nu::Image;
+  EXPECT_FALSE(empty->Encode(options, write));
+}
+
+TEST_F(ImageTest, EncodeToFile) {
+  base::ScopedTempDir dir;
+  ASSERT_TRUE(dir.CreateUniqueTempDir());
+  base::FilePath path = dir.GetPath().Append(FILE_PATH_LITERAL("a.png"));
+  ASSERT_TRUE(static_img_->EncodeToFile(nu::Image::EncodeOptions(), path));
+  scoped_refptr<nu::Image> png = new nu::Image(path);
+  EXPECT_EQ(png->GetSize(), static_img_->GetSize());
+  EXPECT_FALSE(static_img_->EncodeToFile(
+      nu::Image::EncodeOptions(),
+      dir.GetPath().Append(FILE_PATH_LITERAL("no")).Append(
+          FILE_PATH_LITERAL("a.png"))));
+}
+
+TEST_F(ImageTest, Tint) {
+  scoped_refptr<nu::Image> tinted = static_img_->Tint(nu::Color(255, 0, 0));
+  EXPECT_EQ(tinted->GetSize(), static_img_->GetSize());
+  EXPECT_EQ(tinted->GetScaleFactor(), static_img_->GetScaleFactor());
+}
+
+#if defined(OS_LINUX)
+TEST_F(ImageTest, TransformAnimatedImage) {
+  scoped_refptr<nu::Image> tinted = animated_img_->Tint(nu::Color(255, 0, 0));
+  EXPECT_FALSE(gdk_pixbuf_animation_is_static_image(tinted->GetNative()));
+  scoped_refptr<nu::Image> resized =
+      animated_img_->Resize(nu::SizeF(10, 10), 1);
+  EXPECT_EQ(resized->GetSize(), nu::SizeF(10, 10));
+  EXPECT_FALSE(gdk_pixbuf_animation_is_static_image(resized->GetNative()));
+}
+
+TEST_F(ImageTest, TransformRepeatedFrames) {
+  // The frames are red, green, red and blue, the last one shows twice longer.
+  scoped_refptr<nu::Image> resized =
+      repeated_img_->Resize(nu::SizeF(2, 2), 1);
+  GTimeVal time = {0, 0};
+  GdkPixbufAnimationIter* iter =
+      gdk_pixbuf_animation_get_iter(resized->GetNative(), &time);
+  std::vector<uint32_t> expected = {
+    0xFF0000, 0x00FF00, 0xFF0000, 0x0000FF, 0x0000FF, 0xFF0000,
+  };
+  for (size_t i = 0; i < expected.size(); ++i) {
+    // Sample in the middle of each 100ms.
+    time = {0, 0};
+    g_time_val_add(&time, (i * 100 + 50) * 1000);
+    gdk_pixbuf_animation_iter_advance(iter, &time);
+    const uint8_t* p = gdk_pixbuf_read_pixels(
+        gdk_pixbuf_animation_iter_get_pixbuf(iter));
+    EXPECT_EQ(static_cast<uint32_t>(p[0] << 16 | p[1] << 8 | p[2]),
+              expected[i]) << "at " << i * 100 + 50 << "ms";
+  }
+  g_object_unref(iter);
+}
+
+TEST_F(ImageTest, Kernels) {
+  // Odd count to cover the scalar path.
+  std::vector<uint8_t> pixels(4 * 13);
+  for (size_t i = 0; i < 13; ++i) {
+    pixels[i * 4] = 200;
+    pixels[i * 4 + 1] = 100;
+    pixels[i * 4 + 2] = 0;
+    pixels[i * 4 + 3] = 128;
+  }
+  std::vector<uint8_t> tinted = pixels;
+  nu::TintPixels(tinted.data(), 13, nu::Color(128, 0, 0, 255));
+  EXPECT_EQ(tinted[48], 100);
+  EXPECT_EQ(tinted[49], 50);
+  EXPECT_EQ(tinted[50], 128);
+  EXPECT_EQ(tinted[51], 128);
+  nu::PremultiplyPixels(pixels.data(), 13);
+  EXPECT_EQ(pixels[48], 100);
+  EXPECT_EQ(pixels[49], 50);
+  EXPECT_EQ(pixels[51], 128);
+  // Resampling a solid color does not change it.
+  std::vector<uint8_t> dest(4 * 5 * 5);
+  nu::ResamplePixels(pixels.data(), 13, 1, 13 * 4, dest.data(), 5, 5, 5 * 4);
+  EXPECT_EQ(dest[0], 100);
+  EXPECT_EQ(dest[1], 50);
+  EXPECT_EQ(dest[2], 0);
+  EXPECT_EQ(dest[3], 128);
+  // Precision is lost in premultiplied colors.
+  nu::UnpremultiplyPixels(dest.data(), 5 * 5);
+  EXPECT_NEAR(dest[0], 200, 1);
+  EXPECT_NEAR(dest[1], 100, 1);
+  EXPECT_EQ(dest[2], 0);
+  EXPECT_EQ(dest[3], 128);
+}
+#endif
+
+TEST_F(ImageTest, ThemeIcons) {
+  scoped_refptr<nu::Image> icon = static_img_->Resize(nu::SizeF(64, 64), 1);
+  for (int i = 0; i < 4; ++i) {
+    scoped_refptr<nu::Image> tinted = icon->Tint(nu::Color(i * 64, 0, 0));
+    EXPECT_EQ(tinted->GetSize(), nu::SizeF(64, 64));
+    scoped_refptr<nu::Image> resized = tinted->Resize(nu::SizeF(24, 24), 1);
+    EXPECT_EQ(resized->GetSize(), nu::SizeF(24, 24));
+  }
+}
+
+TEST_F(ImageTest, EncodeLargeImage) {
+  scoped_refptr<nu::Image> image =
+      static_img_->Resize(nu::SizeF(1024, 1024), 1);
+  auto encoded_size = [&image](const nu::Image::EncodeOptions& options) {
+    size_t size = 0;
+    EXPECT_TRUE(image->Encode(options, [&size](const nu::Buffer& chunk) {
+      size += chunk.size();
+    }));
+    return size;
+  };
+  nu::Image::EncodeOptions options;
+  EXPECT_GT(encoded_size(options), 0u);
+  options.compression = 1;
+  EXPECT_GT(encoded_size(options), 0u);
+  options.format = nu::Image::Format::JPEG;
+  EXPECT_GT(encoded_size(options), 0u);
+  options.format = nu::Image::Format::QOI;
+  EXPECT_GT(encoded_size(options), 14u + 8u);
+}
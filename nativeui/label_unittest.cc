@@ -2,6 +2,10 @@
 // Use of this source code is governed by the license that can be found in the
 // LICENSE file.
 
+#include <cmath>
+#include <vector>
+
+#include "base/strings/stringprintf.h"
 #include "nativeui/nativeui.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -21,6 +25,75 @@ TEST_F(LabelTest, SetText) {
   EXPECT_EQ(label_->GetText(), "test");
 }
 
+TEST_F(LabelTest, MeasureCache) {
+  scoped_refptr<nu::AttributedText> text = label_->GetAttributedText();
+  nu::RectF bounds = text->GetBoundsFor(nu::SizeF(100, 100));
+  int count = text->GetMeasureCount();
+  EXPECT_EQ(text->GetBoundsFor(nu::SizeF(100, 100)), bounds);
+  EXPECT_EQ(text->GetMeasureCount(), count);
+  // NaN means undefined in yoga.
+  text->GetBoundsFor(nu::SizeF(NAN, NAN));
+  text->GetBoundsFor(nu::SizeF(NAN, NAN));
+  EXPECT_EQ(text->GetMeasureCount(), count + 1);
+  // Changing text invalidates cache.
+  label_->SetText("longer text");
+  EXPECT_GT(text->GetBoundsFor(nu::SizeF(100, 100)).width(), bounds.width());
+  EXPECT_EQ(text->GetMeasureCount(), count + 2);
+  text->SetFormat(text->GetFormat());
+  text->GetBoundsFor(nu::SizeF(100, 100));
+  EXPECT_EQ(text->GetMeasureCount(), count + 3);
+}
+
+TEST_F(LabelTest, MeasureFlexWrapLayout) {
+  scoped_refptr<nu::Window> window = new nu::Window(nu::Window::Options());
+  scoped_refptr<nu::Container> container = new nu::Container;
+  container->SetStyle("flex-direction", "row", "flex-wrap", "wrap");
+  std::vector<scoped_refptr<nu::Label>> labels;
+  for (int i = 0; i < 100; ++i) {
+    labels.push_back(new nu::Label(base::StringPrintf("label %d", i)));
+    container->AddChildView(labels.back().get());
+  }
+  window->SetContentView(container.get());
+  for (int width : {400, 600, 800})
+    window->SetContentSize(nu::SizeF(width, 400));
+  int measure_count = 0;
+  for (const auto& label : labels)
+    measure_count += label->GetAttributedText()->GetMeasureCount();
+
+  // Switching between known sizes should not measure text again.
+  window->SetContentSize(nu::SizeF(600, 400));
+  window->SetContentSize(nu::SizeF(800, 400));
+  int new_count = 0;
+  for (const auto& label : labels)
+    new_count += label->GetAttributedText()->GetMeasureCount();
+  EXPECT_EQ(new_count, measure_count);
+}
+
+#if defined(OS_LINUX)
+TEST_F(LabelTest, MeasureInParallel) {
+  std::vector<scoped_refptr<nu::AttributedText>> texts;
+  std::vector<nu::AttributedText*> pointers;
+  for (int i = 0; i < 100; ++i) {
+    texts.push_back(new nu::AttributedText(
+        base::StringPrintf("text %d", i * 1000), nu::TextFormat()));
+    pointers.push_back(texts.back().get());
+  }
+  nu::AttributedText::MeasureInParallel(pointers);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(texts[i]->IsMeasured());
+    nu::RectF bounds = texts[i]->GetBoundsFor(nu::SizeF(NAN, NAN));
+    EXPECT_EQ(texts[i]->GetMeasureCount(), 0);
+    // Results should be the same with measuring on main thread.
+    scoped_refptr<nu::AttributedText> text = new nu::AttributedText(
+        texts[i]->GetText(), nu::TextFormat());
+    EXPECT_EQ(text->GetBoundsFor(nu::SizeF(NAN, NAN)), bounds);
+    // Larger sizes reuse the result.
+    EXPECT_EQ(texts[i]->GetBoundsFor(nu::SizeF(1000, NAN)), bounds);
+    EXPECT_EQ(texts[i]->GetMeasureCount(), 0);
+  }
+}
+#endif
+
 // FIXME: Enable this test after we have View::GetStyle.
 #if 0
 TEST_F(LabelTest, UpdateStyle) {
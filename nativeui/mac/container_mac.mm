@@ -44,7 +44,7 @@
   nu::PainterMac painter(self);
   painter.SetColor(background_color_);
   painter.FillRect(dirty);
-  shell->on_draw.Emit(shell, &painter, dirty);
+  shell->Draw(&painter, dirty);
 }
 
 @end
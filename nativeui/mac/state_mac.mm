@@ -22,8 +22,7 @@ void State::PlatformInit() {
     [[NSUserDefaults standardUserDefaults] registerDefaults:defaults];
   }
 
-  YGConfigSetPointScaleFactor(yoga_config(),
-                              [NSScreen mainScreen].backingScaleFactor);
+  yoga_config_ = YogaConfig::Get([NSScreen mainScreen].backingScaleFactor);
 }
 
 }  // namespace nu
@@ -251,6 +251,15 @@ void Table::NotifyRowInsertion(uint32_t row) {
                    withAnimation:NSTableViewAnimationEffectNone];
 }
 
+void Table::NotifyRowsInsertion(uint32_t row, uint32_t count) {
+  auto* tableView = static_cast<NSTableView*>(
+      [static_cast<NUTable*>(GetNative()) documentView]);
+  [tableView insertRowsAtIndexes:[NSIndexSet
+                                     indexSetWithIndexesInRange:NSMakeRange(
+                                         row, count)]
+                   withAnimation:NSTableViewAnimationEffectNone];
+}
+
 void Table::NotifyRowDeletion(uint32_t row) {
   auto* tableView = static_cast<NSTableView*>(
       [static_cast<NUTable*>(GetNative()) documentView]);
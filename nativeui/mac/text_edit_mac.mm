@@ -10,7 +10,8 @@
 #include "nativeui/mac/nu_private.h"
 #include "nativeui/mac/nu_view.h"
 
-@interface NUTextViewDelegate : NSObject<NSTextViewDelegate> {
+@interface NUTextViewDelegate : NSObject<NSTextViewDelegate,
+                                          NSTextStorageDelegate> {
  @private
   nu::TextEdit* shell_;
 }
@@ -29,6 +30,22 @@
   shell_->on_text_change.Emit(shell_);
 }
 
+- (void)textStorage:(NSTextStorage*)textStorage
+    didProcessEditing:(NSTextStorageEditActions)editedMask
+                range:(NSRange)editedRange
+       changeInLength:(NSInteger)delta {
+  if (!(editedMask & NSTextStorageEditedCharacters) ||
+      shell_->on_text_delta.IsEmpty() || shell_->IsLoading())
+    return;
+  // The |editedRange| is the range of new text after editing.
+  nu::TextEdit::TextDelta textDelta;
+  textDelta.offset = editedRange.location;
+  textDelta.deleted_length = editedRange.length - delta;
+  textDelta.inserted_text = base::SysNSStringToUTF8(
+      [[textStorage string] substringWithRange:editedRange]);
+  shell_->on_text_delta.Emit(shell_, textDelta);
+}
+
 - (BOOL)textView:(NSTextView*)textView
     doCommandBySelector:(SEL)commandSelector {
   if (commandSelector == @selector(insertNewline:) &&
@@ -57,6 +74,7 @@
     delegate_.reset([[NUTextViewDelegate alloc] initWithShell:shell]);
     textView_.reset([[NSTextView alloc] init]);
     [textView_ setDelegate:delegate_.get()];
+    [[textView_ textStorage] setDelegate:delegate_.get()];
     [textView_ setRichText:NO];
     [textView_ setAllowsUndo:YES];
     // Do not change width to fix text, i.e. alwasys wrap text.
@@ -112,11 +130,47 @@ TextEdit::~TextEdit() {
 }
 
 void TextEdit::SetText(const std::string& text) {
+  CancelLoad();
   auto* textView = static_cast<NSTextView*>(
       [static_cast<NUTextEdit*>(GetNative()) documentView]);
   [textView setString:base::SysUTF8ToNSString(text)];
 }
 
+void TextEdit::PlatformBeginLoad() {
+  auto* textView = static_cast<NSTextView*>(
+      [static_cast<NUTextEdit*>(GetNative()) documentView]);
+  read_only_before_load_ = ![textView isEditable];
+  [textView setEditable:NO];
+  [[textView undoManager] disableUndoRegistration];
+  [textView setString:@""];
+}
+
+void TextEdit::PlatformAppendText(const char* text, size_t length) {
+  auto* textView = static_cast<NSTextView*>(
+      [static_cast<NUTextEdit*>(GetNative()) documentView]);
+  base::scoped_nsobject<NSString> str(
+      [[NSString alloc] initWithBytes:text
+                               length:length
+                             encoding:NSUTF8StringEncoding]);
+  if (!str)
+    return;
+  base::scoped_nsobject<NSAttributedString> attributed_str(
+      [[NSAttributedString alloc] initWithString:str
+                                      attributes:[textView typingAttributes]]);
+  NSTextStorage* storage = [textView textStorage];
+  [storage beginEditing];
+  [storage appendAttributedString:attributed_str];
+  [storage endEditing];
+}
+
+void TextEdit::PlatformEndLoad() {
+  auto* textView = static_cast<NSTextView*>(
+      [static_cast<NUTextEdit*>(GetNative()) documentView]);
+  [[textView undoManager] enableUndoRegistration];
+  [[textView undoManager] removeAllActions];
+  [textView setEditable:!read_only_before_load_];
+}
+
 std::string TextEdit::GetText() const {
   auto* textView = static_cast<NSTextView*>(
       [static_cast<NUTextEdit*>(GetNative()) documentView]);
@@ -186,11 +240,35 @@ void TextEdit::SelectRange(int start, int end) {
 }
 
 std::string TextEdit::GetTextInRange(int start, int end) const {
+  std::string result;
+  ReadRange(start, end, &result);
+  return result;
+}
+
+void TextEdit::ReadRange(int start, int end, std::string* out) const {
   auto* textView = static_cast<NSTextView*>(
       [static_cast<NUTextEdit*>(GetNative()) documentView]);
   NSString* str = [[textView textStorage] string];
-  return base::SysNSStringToUTF8(
-      [str substringWithRange:NSMakeRange(start, end - start)]);
+  NSRange range = NSMakeRange(start, end - start);
+  // Convert into the buffer directly instead of creating a substring, each
+  // UTF-16 unit takes at most 3 bytes in UTF-8.
+  NSUInteger max_length = range.length * 3;
+  out->resize(max_length);
+  NSUInteger used = 0;
+  [str getBytes:&(*out)[0]
+           maxLength:max_length
+          usedLength:&used
+            encoding:NSUTF8StringEncoding
+             options:0
+               range:range
+      remainingRange:nullptr];
+  out->resize(used);
+}
+
+int TextEdit::GetTextLength() const {
+  auto* textView = static_cast<NSTextView*>(
+      [static_cast<NUTextEdit*>(GetNative()) documentView]);
+  return [[textView textStorage] length];
 }
 
 void TextEdit::InsertText(const std::string& text) {
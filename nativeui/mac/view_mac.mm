@@ -125,10 +125,12 @@ Rect View::GetPixelBounds() const {
 }
 
 void View::SchedulePaint() {
+  OnSchedulePaint();
   [view_ setNeedsDisplay:YES];
 }
 
 void View::SchedulePaintRect(const RectF& rect) {
+  OnSchedulePaint();
   [view_ setNeedsDisplayInRect:rect.ToCGRect()];
 }
 
@@ -333,6 +335,14 @@ void View::SetBackgroundColor(Color color) {
     [view_ setNUBackgroundColor:color];
 }
 
+void View::SetOpacity(float opacity) {
+  [view_ setAlphaValue:opacity];
+}
+
+float View::GetOpacity() const {
+  return [view_ alphaValue];
+}
+
 void View::SetWantsLayer(bool wants) {
   [view_ nuPrivate]->wants_layer = wants;
   [view_ setWantsLayer:wants];
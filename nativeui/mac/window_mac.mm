@@ -100,8 +100,7 @@ void Window::PlatformInit(const Options& options) {
   // Disable tab menu items.
   [window_ setTabbingMode:NSWindowTabbingModeDisallowed];
 
-  YGConfigSetPointScaleFactor(yoga_config_,
-                              [window_ screen].backingScaleFactor);
+  yoga_config_ = YogaConfig::Get([window_ screen].backingScaleFactor);
 
   if (!HasFrame()) {
     // Remove title bar.
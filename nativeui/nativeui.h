@@ -5,6 +5,7 @@
 #ifndef NATIVEUI_NATIVEUI_H_
 #define NATIVEUI_NATIVEUI_H_
 
+#include "nativeui/animation.h"
 #include "nativeui/app.h"
 #include "nativeui/appearance.h"
 #include "nativeui/browser.h"
@@ -20,10 +21,12 @@
 #include "nativeui/file_save_dialog.h"
 #include "nativeui/gfx/attributed_text.h"
 #include "nativeui/gfx/canvas.h"
+#include "nativeui/gfx/display_list.h"
 #include "nativeui/gfx/font.h"
 #include "nativeui/gfx/geometry/insets.h"
 #include "nativeui/gfx/image.h"
 #include "nativeui/gfx/painter.h"
+#include "nativeui/gfx/path.h"
 #include "nativeui/gif_player.h"
 #include "nativeui/global_shortcut.h"
 #include "nativeui/group.h"
@@ -44,12 +47,15 @@
 #include "nativeui/separator.h"
 #include "nativeui/slider.h"
 #include "nativeui/state.h"
+#include "nativeui/style_property.h"
+#include "nativeui/style_sheet.h"
 #include "nativeui/tab.h"
 #include "nativeui/table.h"
 #include "nativeui/table_model.h"
 #include "nativeui/text_edit.h"
 #include "nativeui/tray.h"
 #include "nativeui/window.h"
+#include "nativeui/worker.h"
 
 #if defined(OS_MAC)
 #include "nativeui/toolbar.h"
@@ -0,0 +1,238 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <algorithm>
+#include <vector>
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#if defined(OS_LINUX)
+#include <pango/pango.h>
+
+#include "nativeui/gfx/gtk/glyph_atlas.h"
+#endif
+
+class PainterTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    canvas_ = new nu::Canvas(nu::SizeF(400, 400), 1.f);
+  }
+
+  uint32_t GetPixel(int x, int y) {
+    nu::Canvas::Pixels pixels = canvas_->LockPixels();
+    uint32_t pixel = *reinterpret_cast<uint32_t*>(
+        pixels.data + y * pixels.stride + x * 4);
+    canvas_->UnlockPixels();
+    return pixel;
+  }
+
+  template<typename T>
+  static nu::Buffer Wrap(const std::vector<T>& data) {
+    return nu::Buffer::Wrap(data.data(), data.size() * sizeof(T));
+  }
+
+  nu::State state_;
+  scoped_refptr<nu::Canvas> canvas_;
+};
+
+TEST_F(PainterTest, DirtyRects) {
+  nu::Painter* painter = canvas_->GetPainter();
+  std::vector<nu::RectF> rects = painter->GetDirtyRects();
+  ASSERT_EQ(rects.size(), 1u);
+  EXPECT_EQ(rects[0], nu::RectF(0, 0, 400, 400));
+  painter->ClipRect(nu::RectF(0, 0, 10, 10));
+  EXPECT_TRUE(painter->IsRectDirty(nu::RectF(5, 5, 10, 10)));
+  EXPECT_FALSE(painter->IsRectDirty(nu::RectF(20, 20, 5, 5)));
+  // Rects are in current coordinates.
+  painter->Translate(nu::Vector2dF(5, 5));
+  rects = painter->GetDirtyRects();
+  ASSERT_EQ(rects.size(), 1u);
+  EXPECT_EQ(rects[0], nu::RectF(-5, -5, 10, 10));
+  EXPECT_TRUE(painter->IsRectDirty(nu::RectF(4, 4, 1, 1)));
+  EXPECT_FALSE(painter->IsRectDirty(nu::RectF(6, 6, 1, 1)));
+}
+
+TEST_F(PainterTest, DisplayListReplayDirtyRect) {
+  nu::SizeF size(400, 400);
+  scoped_refptr<nu::DisplayList> list = new nu::DisplayList(size);
+  nu::RecordingPainter recorder(list.get());
+  recorder.FillRect(nu::RectF(0, 0, 10, 10));
+  recorder.Translate(nu::Vector2dF(100, 100));
+  recorder.FillRect(nu::RectF(0, 0, 10, 10));
+  EXPECT_EQ(list->GetCommandCount(), 3u);
+  // Replaying emits Save, ClipRect and Restore around the commands.
+  scoped_refptr<nu::DisplayList> all = new nu::DisplayList(size);
+  nu::RecordingPainter all_recorder(all.get());
+  list->Replay(&all_recorder, nu::RectF(0, 0, 400, 400));
+  EXPECT_EQ(all->GetCommandCount(), 6u);
+  // The second rect is skipped.
+  scoped_refptr<nu::DisplayList> part = new nu::DisplayList(size);
+  nu::RecordingPainter part_recorder(part.get());
+  list->Replay(&part_recorder, nu::RectF(0, 0, 50, 50));
+  EXPECT_EQ(part->GetCommandCount(), 5u);
+  list->Replay(canvas_->GetPainter(), nu::RectF(0, 0, 50, 50));
+}
+
+TEST_F(PainterTest, FillRects) {
+  std::vector<float> rects = {10, 10, 20, 20, 50, 50, 20, 20, 100, 100, 5, 5};
+  std::vector<uint32_t> colors = {0xFFFF0000, 0xFF0000FF};
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->FillRects(Wrap(rects), Wrap(colors));
+  EXPECT_EQ(GetPixel(20, 20), 0xFFFF0000);
+  EXPECT_EQ(GetPixel(60, 60), 0xFF0000FF);
+  EXPECT_EQ(GetPixel(40, 40), 0u);
+  // Rects without colors are not drawn.
+  EXPECT_EQ(GetPixel(102, 102), 0u);
+  // Current fill color is used when there is no color.
+  painter->SetFillColor(nu::Color(0, 255, 0));
+  painter->FillRects(Wrap(rects), nu::Buffer());
+  EXPECT_EQ(GetPixel(20, 20), 0xFF00FF00);
+  EXPECT_EQ(GetPixel(102, 102), 0xFF00FF00);
+}
+
+TEST_F(PainterTest, StrokePolyline) {
+  std::vector<float> points = {10, 10.5f, 100, 10.5f, 100, 100.5f};
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->SetStrokeColor(nu::Color(0, 0, 0));
+  painter->SetLineWidth(1);
+  painter->StrokePolyline(Wrap(points));
+  EXPECT_EQ(GetPixel(50, 10) >> 24, 0xFFu);
+  EXPECT_EQ(GetPixel(50, 11) >> 24, 0u);
+  EXPECT_EQ(GetPixel(50, 9) >> 24, 0u);
+  EXPECT_GT(GetPixel(100, 50) >> 24, 0u);
+  // Thick lines are stroked as paths.
+  points = {10, 200, 100, 200};
+  painter->SetLineWidth(4);
+  painter->StrokePolyline(Wrap(points));
+  EXPECT_EQ(GetPixel(50, 201) >> 24, 0xFFu);
+  EXPECT_EQ(GetPixel(50, 203) >> 24, 0u);
+}
+
+TEST_F(PainterTest, DrawPoints) {
+  std::vector<float> points = {100, 100, 200, 200};
+  std::vector<uint32_t> colors = {0xFFFF0000, 0xFF0000FF};
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->DrawPoints(Wrap(points), 10, Wrap(colors));
+  EXPECT_EQ(GetPixel(100, 100), 0xFFFF0000);
+  EXPECT_EQ(GetPixel(200, 200), 0xFF0000FF);
+  EXPECT_EQ(GetPixel(104, 104), 0u);
+}
+
+TEST_F(PainterTest, DisplayListBatches) {
+  std::vector<float> rects = {300, 300, 20, 20};
+  std::vector<uint32_t> colors = {0xFFFF0000};
+  std::vector<float> points = {310, 10, 390, 10};
+  scoped_refptr<nu::DisplayList> list = new nu::DisplayList(nu::SizeF(400,
+                                                                      400));
+  nu::RecordingPainter recorder(list.get());
+  recorder.FillRects(Wrap(rects), Wrap(colors));
+  recorder.StrokePolyline(Wrap(points));
+  recorder.DrawPoints(Wrap(points), 4, Wrap(colors));
+  recorder.FillRect(nu::RectF(10, 10, 10, 10));
+  EXPECT_EQ(list->GetCommandCount(), 4u);
+  // The skipped batches do not affect following commands.
+  list->Replay(canvas_->GetPainter(), nu::RectF(0, 0, 50, 50));
+  EXPECT_EQ(GetPixel(310, 310), 0u);
+  EXPECT_EQ(GetPixel(15, 15) >> 24, 0xFFu);
+  list->Replay(canvas_->GetPainter(), nu::RectF(0, 0, 400, 400));
+  EXPECT_EQ(GetPixel(310, 310), 0xFFFF0000);
+  EXPECT_EQ(GetPixel(390, 10), 0xFFFF0000);
+}
+
+TEST_F(PainterTest, FillManyRects) {
+  const int kRectCount = 400;
+  std::vector<float> rects;
+  std::vector<uint32_t> colors;
+  for (int i = 0; i < kRectCount; ++i) {
+    rects.insert(rects.end(), {i % 20 * 20.f, i / 20 * 20.f, 2, 2});
+    colors.push_back(i % 2 ? 0xFFFF0000 : 0xFF0000FF);
+  }
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->FillRects(Wrap(rects), Wrap(colors));
+  EXPECT_EQ(GetPixel(0, 0), 0xFF0000FF);
+  EXPECT_EQ(GetPixel(21, 1), 0xFFFF0000);
+  EXPECT_EQ(GetPixel(381, 381), 0xFFFF0000);
+  EXPECT_EQ(GetPixel(10, 10), 0u);
+  // Sorting by colors makes adjacent items share one fill.
+  std::vector<float> sorted;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int i = pass; i < kRectCount; i += 2)
+      sorted.insert(sorted.end(), &rects[i * 4], &rects[i * 4 + 4]);
+  }
+  std::vector<uint32_t> sorted_colors(kRectCount, 0xFF00FF00);
+  std::fill(sorted_colors.begin() + kRectCount / 2, sorted_colors.end(),
+            0xFF000000);
+  painter->FillRects(Wrap(sorted), Wrap(sorted_colors));
+  EXPECT_EQ(GetPixel(0, 0), 0xFF00FF00);
+  EXPECT_EQ(GetPixel(21, 1), 0xFF000000);
+}
+
+#if defined(OS_LINUX)
+TEST_F(PainterTest, GlyphAtlas) {
+  nu::Painter* painter = canvas_->GetPainter();
+  nu::GlyphAtlas* atlas = state_.GetGlyphAtlas();
+  painter->SetUseGlyphAtlas(true);
+  painter->DrawText("glyph", nu::RectF(0, 0, 400, 100), nu::TextAttributes());
+  size_t count = atlas->GetGlyphCount();
+  EXPECT_GT(count, 0u);
+  EXPECT_EQ(atlas->GetPageCount(), 1u);
+  // Same glyphs are not rasterized again.
+  painter->DrawText("phly", nu::RectF(0, 0, 400, 100), nu::TextAttributes());
+  EXPECT_EQ(atlas->GetGlyphCount(), count);
+  // Glyphs are rasterized for each scale.
+  painter->Scale(nu::Vector2dF(2, 2));
+  painter->DrawText("glyph", nu::RectF(0, 0, 200, 50), nu::TextAttributes());
+  EXPECT_EQ(atlas->GetGlyphCount(), count * 2);
+  // The option is restored with painter states.
+  painter->Save();
+  painter->SetUseGlyphAtlas(false);
+  painter->Restore();
+  painter->DrawText("abc", nu::RectF(0, 0, 200, 50), nu::TextAttributes());
+  EXPECT_GT(atlas->GetGlyphCount(), count * 2);
+}
+
+TEST_F(PainterTest, GlyphAtlasRunColors) {
+  // Only the first line has a color, the second line uses current source.
+  scoped_refptr<nu::AttributedText> text =
+      new nu::AttributedText("XXXX\nXXXX", nu::TextAttributes());
+  PangoAttrList* attrs = pango_attr_list_new();
+  PangoAttribute* fg_attr = pango_attr_foreground_new(65535, 0, 0);
+  fg_attr->start_index = 0;
+  fg_attr->end_index = 4;
+  pango_attr_list_insert(attrs, fg_attr);
+  pango_layout_set_attributes(text->GetNative(), attrs);
+  pango_attr_list_unref(attrs);
+  nu::RectF rect(0, 0, 400, 100);
+  int middle = text->GetBoundsFor(rect.size()).height() / 2;
+  // Sum of red and alpha of the first and second lines, drawn directly and
+  // from the glyph atlas.
+  uint64_t sums[2][4] = {};
+  for (int i = 0; i < 2; ++i) {
+    scoped_refptr<nu::Canvas> canvas = new nu::Canvas(rect.size(), 1.f);
+    canvas->GetPainter()->SetUseGlyphAtlas(i == 1);
+    canvas->GetPainter()->DrawAttributedText(text, rect);
+    nu::Canvas::Pixels pixels = canvas->LockPixels();
+    for (int y = 0; y < pixels.height; ++y) {
+      const uint32_t* row = reinterpret_cast<const uint32_t*>(
+          pixels.data + y * pixels.stride);
+      uint64_t* line = sums[i] + (y < middle ? 0 : 2);
+      for (int x = 0; x < pixels.width; ++x) {
+        line[0] += (row[x] >> 16) & 0xFF;
+        line[1] += row[x] >> 24;
+      }
+    }
+    canvas->UnlockPixels();
+  }
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_GT(sums[i][0], 0u);
+    EXPECT_GT(sums[i][3], 0u);
+    EXPECT_EQ(sums[i][2], 0u);
+  }
+  // Glyphs in the atlas are positioned in whole pixels, allow some errors.
+  EXPECT_NEAR(sums[1][0], sums[0][0], sums[0][0] / 10.);
+  EXPECT_NEAR(sums[1][1], sums[0][1], sums[0][1] / 10.);
+  EXPECT_NEAR(sums[1][3], sums[0][3], sums[0][3] / 10.);
+}
+#endif
@@ -0,0 +1,137 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <vector>
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class PathTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    canvas_ = new nu::Canvas(nu::SizeF(100, 100), 1.f);
+  }
+
+  uint32_t GetAlpha(int x, int y) {
+    nu::Canvas::Pixels pixels = canvas_->LockPixels();
+    uint32_t pixel = *reinterpret_cast<uint32_t*>(
+        pixels.data + y * pixels.stride + x * 4);
+    canvas_->UnlockPixels();
+    return pixel >> 24;
+  }
+
+  nu::State state_;
+  scoped_refptr<nu::Canvas> canvas_;
+};
+
+TEST_F(PathTest, Build) {
+  scoped_refptr<nu::Path> path = new nu::Path;
+  EXPECT_TRUE(path->IsEmpty());
+  // LineTo without current point works as MoveTo.
+  path->LineTo(nu::PointF(10, 10));
+  path->LineTo(nu::PointF(20, 10));
+  path->ClosePath();
+  std::vector<float> data = {0, 10, 10, 1, 20, 10, 5};
+  EXPECT_EQ(path->GetData(), data);
+  path->Clear();
+  path->Rect(nu::RectF(10, 20, 30, 40));
+  EXPECT_EQ(path->GetBounds(), nu::RectF(10, 20, 30, 40));
+  // Quadratic curves and arcs are stored as cubic curves.
+  path->Clear();
+  path->MoveTo(nu::PointF(0, 0));
+  path->QuadraticCurveTo(nu::PointF(30, 0), nu::PointF(30, 30));
+  data = {0, 0, 0, 2, 20, 0, 30, 10, 30, 30};
+  EXPECT_EQ(path->GetData(), data);
+  path->Clear();
+  path->Arc(nu::PointF(50, 50), 10, 0, 6.3f);
+  EXPECT_EQ(path->GetData().size(), 3u + 4 * 7);
+  nu::RectF bounds = path->GetBounds();
+  EXPECT_NEAR(bounds.x(), 40, 0.5);
+  EXPECT_NEAR(bounds.bottom(), 60, 0.5);
+}
+
+TEST_F(PathTest, ParseSVG) {
+  scoped_refptr<nu::Path> path = new nu::Path("M10,10 h 20 v20 H10 z");
+  std::vector<float> data = {0, 10, 10, 1, 30, 10, 1, 30, 30, 1, 10, 30, 5};
+  EXPECT_EQ(path->GetData(), data);
+  // Implicit commands, relative commands and compact numbers.
+  path = new nu::Path("m1-2.5.5 1e1l-1 1");
+  data = {0, 1, -2.5f, 1, 1.5f, 7.5f, 1, 0.5f, 8.5f};
+  EXPECT_EQ(path->GetData(), data);
+  // Smooth curves reflect the last control point.
+  path = new nu::Path("M0 0 C 0 10 10 10 10 0 S 20 -10 20 0");
+  data = {0, 0, 0, 2, 0, 10, 10, 10, 10, 0, 2, 10, -10, 20, -10, 20, 0};
+  EXPECT_EQ(path->GetData(), data);
+  // Arcs end at the exact end point, flags can be compact.
+  path = new nu::Path("M0 0 A10 10 0 0110 10");
+  ASSERT_GT(path->GetData().size(), 3u);
+  EXPECT_EQ(path->GetData().back(), 10);
+  EXPECT_NEAR(path->GetBounds().right(), 10, 0.5);
+  // Parsing stops at the first error.
+  path = new nu::Path("M0 0 L10 10 L20 # L30 30");
+  data = {0, 0, 0, 1, 10, 10};
+  EXPECT_EQ(path->GetData(), data);
+  path = new nu::Path("L10 10");
+  EXPECT_TRUE(path->IsEmpty());
+}
+
+TEST_F(PathTest, ParseData) {
+  std::vector<float> input = {0, 10, 10, 4, 10, 10, 5, 0, 3.2f, 5};
+  scoped_refptr<nu::Path> path = new nu::Path(input);
+  std::vector<float> data = path->GetData();
+  ASSERT_FALSE(data.empty());
+  EXPECT_EQ(data.back(), 5);
+  // Invalid commands stop parsing.
+  path = new nu::Path(std::vector<float>{0, 1, 1, 9, 1, 2});
+  EXPECT_EQ(path->GetData().size(), 3u);
+  path = new nu::Path(std::vector<float>{0, 1, 1, 1, 2});
+  EXPECT_EQ(path->GetData().size(), 3u);
+}
+
+TEST_F(PathTest, FillAndStroke) {
+  scoped_refptr<nu::Path> path = new nu::Path("M10 10 h40 v40 h-40 z");
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->SetFillColor(nu::Color(255, 0, 0));
+  painter->FillPath(path.get());
+  EXPECT_EQ(GetAlpha(30, 30), 0xFFu);
+  EXPECT_EQ(GetAlpha(60, 60), 0u);
+  // Paths are drawn under current transform.
+  painter->Save();
+  painter->Translate(nu::Vector2dF(50, 50));
+  painter->SetStrokeColor(nu::Color(0, 0, 255));
+  painter->SetLineWidth(4);
+  painter->StrokePath(path.get());
+  painter->Restore();
+  EXPECT_EQ(GetAlpha(60, 70), 0xFFu);
+  EXPECT_EQ(GetAlpha(80, 80), 0u);
+}
+
+TEST_F(PathTest, RecordAndReplay) {
+  scoped_refptr<nu::Path> path = new nu::Path("M60 60 h20 v20 h-20 z");
+  scoped_refptr<nu::DisplayList> list = new nu::DisplayList(nu::SizeF(100,
+                                                                      100));
+  nu::RecordingPainter recorder(list.get());
+  recorder.FillPath(path.get());
+  EXPECT_EQ(list->GetCommandCount(), 1u);
+  // Drawing out of the dirty rect is skipped.
+  list->Replay(canvas_->GetPainter(), nu::RectF(0, 0, 50, 50));
+  EXPECT_EQ(GetAlpha(70, 70), 0u);
+  list->Replay(canvas_->GetPainter(), nu::RectF(0, 0, 100, 100));
+  EXPECT_EQ(GetAlpha(70, 70), 0xFFu);
+}
+
+TEST_F(PathTest, StrokeManySegments) {
+  const int kSegments = 2000;
+  std::vector<float> data = {0, 0, 50};
+  for (int i = 1; i < kSegments; ++i)
+    data.insert(data.end(), {1, i * 100.f / kSegments, 50});
+  scoped_refptr<nu::Path> path = new nu::Path(data);
+  EXPECT_EQ(path->GetData(), data);
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->SetStrokeColor(nu::Color(0, 0, 255));
+  painter->SetLineWidth(4);
+  painter->StrokePath(path.get());
+  EXPECT_EQ(GetAlpha(50, 50), 0xFFu);
+  EXPECT_EQ(GetAlpha(50, 10), 0u);
+}
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -21,10 +22,33 @@ class SignalDelegate {
   virtual void OnConnect(int identifier) {}
 };
 
+// Slot implemented by language bindings, which can call into the script
+// engine directly instead of going through std::function.
+template<typename Sig> class SignalSlot;
+
+template<typename ReturnType, typename... Args>
+class SignalSlot<ReturnType(Args...)> {
+ public:
+  virtual ~SignalSlot() {}
+  virtual ReturnType Call(Args... args) = 0;
+};
+
 // A simple signal/slot implementation.
 template<typename Sig> class SignalBase {
  public:
   using Slot = std::function<Sig>;
+  using CustomSlot = SignalSlot<Sig>;
+
+  SignalBase() = default;
+
+  ~SignalBase() {
+    // Keep the slots alive if the signal is destroyed by a slot.
+    if (emit_scope_)
+      emit_scope_->OnSignalDestroyed(std::move(slots_));
+  }
+
+  SignalBase& operator=(const SignalBase&) = delete;
+  SignalBase(const SignalBase&) = delete;
 
   void SetDelegate(SignalDelegate* delegate, int identifier = 0) {
     delegate_ = delegate;
@@ -33,35 +57,146 @@ template<typename Sig> class SignalBase {
 
   int Connect(Slot slot) {
     CHECK(slot);
-    if (delegate_ && slots_.empty())
-      delegate_->OnConnect(identifier_);
-    slots_.push_back(std::make_pair(++next_id_, std::move(slot)));
-    return next_id_;
+    return AddSlot({0, std::move(slot)});
+  }
+
+  int Connect(std::unique_ptr<CustomSlot> slot) {
+    CHECK(slot);
+    return AddSlot({0, nullptr, std::move(slot)});
   }
 
   void Disconnect(int id) {
-    auto iter = std::lower_bound(slots_.begin(), slots_.end(),
-                                 id, TupleCompare);
-    if (iter != slots_.end() && std::get<0>(*iter) == id)
-      slots_.erase(iter);
+    for (auto* slots : {&slots_, &pending_slots_}) {
+      auto iter = std::lower_bound(slots->begin(), slots->end(),
+                                   id, SlotCompare);
+      if (iter != slots->end() && iter->id == id) {
+        Remove(slots, iter);
+        return;
+      }
+    }
   }
 
   void DisconnectAll() {
-    slots_.clear();
+    if (emit_scope_) {
+      for (auto& slot : slots_)
+        slot.removed = true;
+      has_removed_slots_ = !slots_.empty();
+    } else {
+      slots_.clear();
+    }
+    pending_slots_.clear();
   }
 
   bool IsEmpty() const {
-    return slots_.empty();
+    auto is_alive = [](const SlotEntry& slot) { return !slot.removed; };
+    return std::none_of(slots_.begin(), slots_.end(), is_alive) &&
+           pending_slots_.empty();
   }
 
  protected:
-  // Use the first element of tuple as comparing key.
-  static bool TupleCompare(const std::pair<int, Slot>& element, int key) {
-    return element.first < key;
+  struct SlotEntry {
+    template<typename... EmitArgs>
+    auto Run(EmitArgs&&... args) {
+      if (custom_slot)
+        return custom_slot->Call(std::forward<EmitArgs>(args)...);
+      return slot(std::forward<EmitArgs>(args)...);
+    }
+
+    int id;
+    Slot slot;
+    std::unique_ptr<CustomSlot> custom_slot;
+    // Slots disconnected when emitting are only marked, and then erased after
+    // emitting, so the running slot is never destroyed.
+    bool removed = false;
+  };
+
+  // Defers changes to the list of slots until the outermost Emit returns, so
+  // Emit can iterate the list without copying it.
+  class EmitScope {
+   public:
+    explicit EmitScope(SignalBase* signal)
+        : signal_(signal), outer_(signal->emit_scope_) {
+      signal_->emit_scope_ = this;
+    }
+
+    ~EmitScope() {
+      if (signal_destroyed_) {
+        // The outer Emit is still iterating the slots.
+        if (outer_)
+          outer_->OnSignalDestroyed(std::move(orphaned_slots_));
+        return;
+      }
+      signal_->emit_scope_ = outer_;
+      if (!outer_)
+        signal_->ApplyDeferredChanges();
+    }
+
+    // Moving a vector does not invalidate iterators, so the Emit calls can
+    // keep iterating after the signal is gone.
+    void OnSignalDestroyed(std::vector<SlotEntry> slots) {
+      signal_destroyed_ = true;
+      orphaned_slots_ = std::move(slots);
+    }
+
+    EmitScope& operator=(const EmitScope&) = delete;
+    EmitScope(const EmitScope&) = delete;
+
+   private:
+    SignalBase* signal_;
+    EmitScope* outer_;
+    bool signal_destroyed_ = false;
+    std::vector<SlotEntry> orphaned_slots_;
+  };
+
+  int AddSlot(SlotEntry entry) {
+    if (delegate_ && IsEmpty())
+      delegate_->OnConnect(identifier_);
+    entry.id = ++next_id_;
+    // The list being iterated must not be modified when emitting, otherwise
+    // the running slot could be moved.
+    auto& slots = emit_scope_ ? pending_slots_ : slots_;
+    slots.push_back(std::move(entry));
+    return next_id_;
+  }
+
+  // Use the id as comparing key.
+  static bool SlotCompare(const SlotEntry& element, int key) {
+    return element.id < key;
+  }
+
+  void Remove(std::vector<SlotEntry>* slots,
+              typename std::vector<SlotEntry>::iterator iter) {
+    if (slots == &slots_ && emit_scope_) {
+      iter->removed = true;
+      has_removed_slots_ = true;
+    } else {
+      slots->erase(iter);
+    }
+  }
+
+  void ApplyDeferredChanges() {
+    if (has_removed_slots_) {
+      slots_.erase(std::remove_if(slots_.begin(), slots_.end(),
+                                  [](const SlotEntry& slot) {
+                                    return slot.removed;
+                                  }),
+                   slots_.end());
+      has_removed_slots_ = false;
+    }
+    for (auto& slot : pending_slots_)
+      slots_.push_back(std::move(slot));
+    pending_slots_.clear();
   }
 
   int next_id_ = 0;
-  std::vector<std::pair<int, Slot>> slots_;
+  std::vector<SlotEntry> slots_;
+
+  // Slots connected when emitting.
+  std::vector<SlotEntry> pending_slots_;
+  bool has_removed_slots_ = false;
+
+  // The innermost Emit call.
+  EmitScope* emit_scope_ = nullptr;
 
   int identifier_ = 0;
   SignalDelegate* delegate_ = nullptr;
@@ -77,11 +212,11 @@ class Signal<void(Args...)> : public SignalBase<void(Args...)> {
 
   template<typename... EmitArgs>
   void Emit(EmitArgs&&... args) {
-    // Copy the list before iterating, since it is possible that user removes
-    // elements from the list when iterating.
-    auto slots = this->slots_;
-    for (auto& slot : slots)
-      slot.second(std::forward<EmitArgs>(args)...);
+    typename Base::EmitScope scope(this);
+    for (auto& slot : this->slots_) {
+      if (!slot.removed)
+        slot.Run(std::forward<EmitArgs>(args)...);
+    }
   }
 };
 
@@ -93,11 +228,9 @@ class Signal<bool(Args...)> : public SignalBase<bool(Args...)> {
 
   template<typename... EmitArgs>
   bool Emit(EmitArgs&&... args) {
-    // Copy the list before iterating, since it is possible that user removes
-    // elements from the list when iterating.
-    auto slots = this->slots_;
-    for (auto& slot : slots) {
-      if (slot.second(std::forward<EmitArgs>(args)...))
+    typename Base::EmitScope scope(this);
+    for (auto& slot : this->slots_) {
+      if (!slot.removed && slot.Run(std::forward<EmitArgs>(args)...))
         return true;
     }
     return false;
@@ -29,3 +29,55 @@ TEST_F(SignalTest, ZeroCopy) {
   });
   signal.Emit(Copiable());
 }
+
+TEST_F(SignalTest, DisconnectWhenEmitting) {
+  nu::Signal<void()> signal;
+  int count = 0;
+  int id = 0;
+  signal.Connect([&]() {
+    count++;
+    signal.Disconnect(id);
+  });
+  id = signal.Connect([&]() { count += 10; });
+  signal.Emit();
+  EXPECT_EQ(count, 1);
+  signal.Emit();
+  EXPECT_EQ(count, 2);
+}
+
+TEST_F(SignalTest, ConnectWhenEmitting) {
+  nu::Signal<void()> signal;
+  int count = 0;
+  signal.Connect([&]() {
+    count++;
+    signal.Connect([&]() { count += 10; });
+  });
+  signal.Emit();
+  EXPECT_EQ(count, 1);
+  signal.Emit();
+  EXPECT_EQ(count, 12);
+}
+
+TEST_F(SignalTest, DestroyWhenEmitting) {
+  auto* signal = new nu::Signal<void()>;
+  int count = 0;
+  signal->Connect([&]() {
+    count++;
+    delete signal;
+  });
+  signal->Connect([&]() { count++; });
+  signal->Emit();
+  EXPECT_EQ(count, 2);
+}
+
+TEST_F(SignalTest, DisconnectAllWhenEmitting) {
+  nu::Signal<bool()> signal;
+  signal.Connect([&]() {
+    signal.DisconnectAll();
+    EXPECT_TRUE(signal.IsEmpty());
+    return false;
+  });
+  signal.Connect([]() { return true; });
+  EXPECT_FALSE(signal.Emit());
+  EXPECT_TRUE(signal.IsEmpty());
+}
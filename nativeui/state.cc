@@ -8,6 +8,7 @@
 
 #include "base/lazy_instance.h"
 #include "base/threading/thread_local.h"
+#include "nativeui/animation_timeline.h"
 #include "nativeui/appearance.h"
 #include "nativeui/gfx/font.h"
 #include "nativeui/global_shortcut.h"
@@ -29,6 +30,7 @@
 #include "nativeui/win/util/tray_host.h"
 #elif defined(OS_LINUX)
 #include "nativeui/gfx/gtk/gtk_theme.h"
+#include "nativeui/gfx/gtk/text_shaper.h"
 #endif
 
 namespace nu {
@@ -54,12 +56,13 @@ State* State::GetMain() {
   return g_main_state;
 }
 
-State::State() : yoga_config_(YGConfigNew()) {
+State::State() {
   DCHECK_EQ(GetCurrent(), nullptr) << "should only have one state per thread";
 
   if (!g_main_state)
     g_main_state = this;
   lazy_tls_ptr.Pointer()->Set(this);
+  yoga_config_ = YogaConfig::Get(1.f);
   PlatformInit();
 
   for (int i = 0; i < static_cast<int>(Clipboard::Type::Count); ++i)
@@ -67,7 +70,10 @@ State::State() : yoga_config_(YGConfigNew()) {
 }
 
 State::~State() {
-  YGConfigFree(yoga_config_);
+  // Running animations keep references to views.
+  animation_timeline_.reset();
+  yoga_config_ = nullptr;
+  DCHECK(yoga_configs_.empty()) << "There are views leaked on exit";
 
   if (g_main_state == this)
     g_main_state = nullptr;
@@ -109,4 +115,10 @@ NotificationCenter* State::GetNotificationCenter() {
   return notification_center_.get();
 }
 
+AnimationTimeline* State::GetAnimationTimeline() {
+  if (!animation_timeline_)
+    animation_timeline_.reset(new AnimationTimeline);
+  return animation_timeline_.get();
+}
+
 }  // namespace nu
@@ -6,12 +6,13 @@
 #define NATIVEUI_STATE_H_
 
 #include <array>
+#include <map>
 #include <memory>
+#include <string>
 
 #include "base/memory/ref_counted.h"
 #include "nativeui/app.h"
-
-typedef struct YGConfig *YGConfigRef;
+#include "nativeui/util/yoga_config.h"
 
 #if defined(OS_WIN)
 namespace base {
@@ -24,6 +25,7 @@ class ScopedCOMInitializer;
 
 namespace nu {
 
+class AnimationTimeline;
 class Appearance;
 class Font;
 class GlobalShortcut;
@@ -40,7 +42,10 @@ class TrayHost;
 class TimerHost;
 class TooltipHost;
 #elif defined(OS_LINUX)
+class GlyphAtlas;
 class GtkTheme;
+class SurfacePool;
+class TextShaper;
 #endif
 
 class NATIVEUI_EXPORT State {
@@ -71,6 +76,9 @@ class NATIVEUI_EXPORT State {
   UINT GetNextCommandID();
 #elif defined(OS_LINUX)
   GtkTheme* GetGtkTheme();
+  TextShaper* GetTextShaper();
+  GlyphAtlas* GetGlyphAtlas();
+  SurfacePool* GetSurfacePool();
 #endif
 
   // Internal: Return the clipboards.
@@ -88,11 +96,20 @@ class NATIVEUI_EXPORT State {
   // Internal: Return the notificationCenter object
   NotificationCenter* GetNotificationCenter();
 
+  // Internal: Return the timeline that drives all animations.
+  AnimationTimeline* GetAnimationTimeline();
+
   // Internal: Return the default font.
   scoped_refptr<Font>& default_font() { return default_font_; }
 
+  // Internal: Return the interned fonts.
+  std::map<std::string, Font*>& fonts() { return fonts_; }
+
   // Internal: Return the default yoga config.
-  YGConfigRef yoga_config() const { return yoga_config_; }
+  YogaConfig* yoga_config() const { return yoga_config_.get(); }
+
+  // Internal: Return the interned yoga configs.
+  std::map<float, YogaConfig*>& yoga_configs() { return yoga_configs_; }
 
  private:
   void PlatformInit();
@@ -116,6 +133,9 @@ class NATIVEUI_EXPORT State {
 
 #if defined(OS_LINUX)
   std::unique_ptr<GtkTheme> gtk_theme_;
+  std::unique_ptr<TextShaper> text_shaper_;
+  std::unique_ptr<GlyphAtlas> glyph_atlas_;
+  std::unique_ptr<SurfacePool> surface_pool_;
 #endif
 
   // Array of available clipboards.
@@ -126,12 +146,15 @@ class NATIVEUI_EXPORT State {
   std::unique_ptr<Appearance> appearance_;
   std::unique_ptr<GlobalShortcut> global_shortcut_;
   std::unique_ptr<NotificationCenter> notification_center_;
+  std::unique_ptr<AnimationTimeline> animation_timeline_;
   scoped_refptr<Font> default_font_;
+  std::map<std::string, Font*> fonts_;
 
   // The app instance.
   App app_;
 
-  YGConfigRef yoga_config_;
+  scoped_refptr<YogaConfig> yoga_config_;
+  std::map<float, YogaConfig*> yoga_configs_;
 };
 
 }  // namespace nu
@@ -0,0 +1,149 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/style_property.h"
+
+#include "base/check.h"
+
+namespace nu {
+
+namespace {
+
+// Normalized names, in the order of StyleProperty.
+constexpr const char* kNames[] = {
+  "aligncontent",
+  "alignitems",
+  "alignself",
+  "aspectratio",
+  "backgroundcolor",
+  "border",
+  "borderbottom",
+  "borderleft",
+  "borderright",
+  "bordertop",
+  "bottom",
+  "color",
+  "columngap",
+  "direction",
+  "display",
+  "flex",
+  "flexbasis",
+  "flexdirection",
+  "flexgrow",
+  "flexshrink",
+  "flexwrap",
+  "gap",
+  "height",
+  "justifycontent",
+  "left",
+  "margin",
+  "marginbottom",
+  "marginleft",
+  "marginright",
+  "margintop",
+  "maxheight",
+  "maxwidth",
+  "minheight",
+  "minwidth",
+  "overflow",
+  "padding",
+  "paddingbottom",
+  "paddingleft",
+  "paddingright",
+  "paddingtop",
+  "position",
+  "right",
+  "rowgap",
+  "top",
+  "width",
+};
+
+static_assert(sizeof(kNames) / sizeof(kNames[0]) == kStylePropertyCount,
+              "Every style property must have a name");
+
+// The names are hashed with FNV-1a into a table of 128 slots using the top
+// bits of the hash, the seed is chosen so no two names share a slot. When
+// adding properties, find a new seed if the static_assert below fails.
+constexpr uint32_t kHashSeed = 2181;
+constexpr int kSlotBits = 7;
+constexpr size_t kSlotCount = 1 << kSlotBits;
+constexpr uint8_t kEmptySlot = 0xFF;
+
+constexpr bool IsAlpha(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+constexpr char ToLower(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// Hash the normalized form of the name.
+constexpr size_t HashName(const char* str, size_t length) {
+  uint32_t hash = 2166136261u ^ kHashSeed;
+  for (size_t i = 0; i < length; ++i) {
+    if (!IsAlpha(str[i]))
+      continue;
+    hash ^= static_cast<uint8_t>(ToLower(str[i]));
+    hash *= 16777619u;
+  }
+  return hash >> (32 - kSlotBits);
+}
+
+constexpr size_t StringLength(const char* str) {
+  size_t length = 0;
+  while (str[length])
+    ++length;
+  return length;
+}
+
+struct SlotTable {
+  uint8_t slots[kSlotCount];
+  bool has_collision;
+};
+
+constexpr SlotTable BuildSlotTable() {
+  SlotTable table = {};
+  for (size_t i = 0; i < kSlotCount; ++i)
+    table.slots[i] = kEmptySlot;
+  for (size_t i = 0; i < kStylePropertyCount; ++i) {
+    size_t slot = HashName(kNames[i], StringLength(kNames[i]));
+    if (table.slots[slot] != kEmptySlot)
+      table.has_collision = true;
+    table.slots[slot] = static_cast<uint8_t>(i);
+  }
+  return table;
+}
+
+constexpr SlotTable kSlotTable = BuildSlotTable();
+
+static_assert(!kSlotTable.has_collision,
+              "Style property names must not collide, change kHashSeed");
+
+// Compare |name| with the normalized |expected| name.
+bool MatchName(base::StringPiece name, const char* expected) {
+  for (char c : name) {
+    if (!IsAlpha(c))
+      continue;
+    if (ToLower(c) != *expected)
+      return false;
+    ++expected;
+  }
+  return *expected == '\0';
+}
+
+}  // namespace
+
+StyleProperty GetStyleProperty(base::StringPiece name) {
+  uint8_t index = kSlotTable.slots[HashName(name.data(), name.size())];
+  if (index == kEmptySlot || !MatchName(name, kNames[index]))
+    return StyleProperty::Invalid;
+  return static_cast<StyleProperty>(index);
+}
+
+const char* GetStylePropertyName(StyleProperty property) {
+  DCHECK_LT(static_cast<size_t>(property), kStylePropertyCount);
+  return kNames[static_cast<size_t>(property)];
+}
+
+}  // namespace nu
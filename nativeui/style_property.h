@@ -0,0 +1,83 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_STYLE_PROPERTY_H_
+#define NATIVEUI_STYLE_PROPERTY_H_
+
+#include <stdint.h>
+
+#include "base/strings/string_piece.h"
+#include "nativeui/nativeui_export.h"
+
+namespace nu {
+
+// The style properties that can be set on views, sorted by their names.
+enum class StyleProperty : uint8_t {
+  AlignContent,
+  AlignItems,
+  AlignSelf,
+  AspectRatio,
+  BackgroundColor,
+  Border,
+  BorderBottom,
+  BorderLeft,
+  BorderRight,
+  BorderTop,
+  Bottom,
+  Color,
+  ColumnGap,
+  Direction,
+  Display,
+  Flex,
+  FlexBasis,
+  FlexDirection,
+  FlexGrow,
+  FlexShrink,
+  FlexWrap,
+  Gap,
+  Height,
+  JustifyContent,
+  Left,
+  Margin,
+  MarginBottom,
+  MarginLeft,
+  MarginRight,
+  MarginTop,
+  MaxHeight,
+  MaxWidth,
+  MinHeight,
+  MinWidth,
+  Overflow,
+  Padding,
+  PaddingBottom,
+  PaddingLeft,
+  PaddingRight,
+  PaddingTop,
+  Position,
+  Right,
+  RowGap,
+  Top,
+  Width,
+  Invalid,
+};
+
+// Number of valid style properties.
+constexpr size_t kStylePropertyCount =
+    static_cast<size_t>(StyleProperty::Invalid);
+
+// Resolve the property from its name, the name is case insensitive and
+// non-alphabet characters are ignored, so "flex-direction", "flexDirection"
+// and "FlexDirection" are the same property.
+//
+// Names are looked up in a perfect hash table without allocations, language
+// bindings should still cache the result when setting the same property on
+// many views.
+NATIVEUI_EXPORT StyleProperty GetStyleProperty(base::StringPiece name);
+
+// Return the normalized name of |property|.
+NATIVEUI_EXPORT const char* GetStylePropertyName(StyleProperty property);
+
+}  // namespace nu
+
+#endif  // NATIVEUI_STYLE_PROPERTY_H_
@@ -0,0 +1,57 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/style_sheet.h"
+
+namespace nu {
+
+StyleSheet::StyleSheet() {}
+
+StyleSheet::~StyleSheet() {}
+
+void StyleSheet::Set(StyleProperty property, const std::string& value) {
+  Entry* entry = GetEntry(property);
+  if (!entry)
+    return;
+  if (property == StyleProperty::Color ||
+      property == StyleProperty::BackgroundColor)
+    entry->color = Color(value);
+  else
+    entry->layout = ParseYogaValue(property, value);
+}
+
+void StyleSheet::Set(StyleProperty property, float value) {
+  // Colors can not be numbers.
+  if (property == StyleProperty::Color ||
+      property == StyleProperty::BackgroundColor)
+    return;
+  Entry* entry = GetEntry(property);
+  if (!entry)
+    return;
+  entry->layout.type = YogaValue::Type::Point;
+  entry->layout.number = value;
+}
+
+void StyleSheet::Set(const std::string& name, const std::string& value) {
+  Set(GetStyleProperty(name), value);
+}
+
+void StyleSheet::Set(const std::string& name, float value) {
+  Set(GetStyleProperty(name), value);
+}
+
+StyleSheet::Entry* StyleSheet::GetEntry(StyleProperty property) {
+  if (property == StyleProperty::Invalid)
+    return nullptr;
+  for (Entry& entry : entries_) {
+    if (entry.property == property) {
+      entry = {property};
+      return &entry;
+    }
+  }
+  entries_.push_back({property});
+  return &entries_.back();
+}
+
+}  // namespace nu
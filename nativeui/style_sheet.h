@@ -0,0 +1,53 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_STYLE_SHEET_H_
+#define NATIVEUI_STYLE_SHEET_H_
+
+#include <string>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/color.h"
+#include "nativeui/style_property.h"
+#include "nativeui/util/yoga_util.h"
+
+namespace nu {
+
+// A list of styles whose values are parsed once, so they can be applied to
+// many views without parsing strings again.
+//
+// A style sheet should not be modified after it is shared by views.
+class NATIVEUI_EXPORT StyleSheet : public base::RefCounted<StyleSheet> {
+ public:
+  StyleSheet();
+
+  // Add a style, the value replaces the old one of the same property.
+  void Set(StyleProperty property, const std::string& value);
+  void Set(StyleProperty property, float value);
+  void Set(const std::string& name, const std::string& value);
+  void Set(const std::string& name, float value);
+
+  uint32_t GetSize() const { return static_cast<uint32_t>(entries_.size()); }
+
+ private:
+  friend class base::RefCounted<StyleSheet>;
+  friend class View;
+
+  struct Entry {
+    StyleProperty property;
+    YogaValue layout;
+    Color color;
+  };
+
+  ~StyleSheet();
+
+  Entry* GetEntry(StyleProperty property);
+
+  std::vector<Entry> entries_;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_STYLE_SHEET_H_
@@ -84,6 +84,7 @@ class NATIVEUI_EXPORT Table : public View {
 
   // Called by TableModel.
   void NotifyRowInsertion(uint32_t row);
+  void NotifyRowsInsertion(uint32_t row, uint32_t count);
   void NotifyRowDeletion(uint32_t row);
   void NotifyValueChange(uint32_t column, uint32_t row);
 
@@ -4,9 +4,11 @@
 
 #include "nativeui/table_model.h"
 
+#include <iterator>
 #include <utility>
 
 #include "base/logging.h"
+#include "base/notreached.h"
 #include "nativeui/table.h"
 
 namespace nu {
@@ -23,6 +25,11 @@ void TableModel::NotifyRowInsertion(uint32_t row) {
     table->NotifyRowInsertion(row);
 }
 
+void TableModel::NotifyRowsInsertion(uint32_t row, uint32_t count) {
+  for (Table* table : tables_)
+    table->NotifyRowsInsertion(row, count);
+}
+
 void TableModel::NotifyRowDeletion(uint32_t row) {
   for (Table* table : tables_)
     table->NotifyRowDeletion(row);
@@ -122,4 +129,140 @@ void SimpleTableModel::SetValue(uint32_t column, uint32_t row,
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// ColumnarTableModel implementation.
+
+ColumnarTableModel::Column::Column() : type(Type::Number) {}
+
+ColumnarTableModel::Column::Column(std::vector<double> numbers)
+    : type(Type::Number), numbers(std::move(numbers)) {}
+
+ColumnarTableModel::Column::Column(std::vector<int32_t> integers)
+    : type(Type::Integer), integers(std::move(integers)) {}
+
+ColumnarTableModel::Column::Column(std::vector<std::string> strings)
+    : type(Type::String), strings(std::move(strings)) {}
+
+ColumnarTableModel::Column::Column(Column&& other) = default;
+
+ColumnarTableModel::Column::~Column() = default;
+
+ColumnarTableModel::Column& ColumnarTableModel::Column::operator=(
+    Column&& other) = default;
+
+size_t ColumnarTableModel::Column::size() const {
+  switch (type) {
+    case Type::Number:
+      return numbers.size();
+    case Type::Integer:
+      return integers.size();
+    case Type::String:
+      return strings.size();
+  }
+  NOTREACHED();
+  return 0;
+}
+
+ColumnarTableModel::ColumnarTableModel(uint32_t columns) : columns_(columns) {}
+
+ColumnarTableModel::~ColumnarTableModel() {}
+
+void ColumnarTableModel::AppendRows(std::vector<Column> columns) {
+  if (columns.size() < columns_) {
+    LOG(ERROR) << "AppendRows failed because there are less columns than "
+                  "column size.";
+    return;
+  }
+  columns.erase(columns.begin() + columns_, columns.end());
+  if (columns.empty())
+    return;
+  size_t count = columns[0].size();
+  for (uint32_t i = 0; i < columns_; ++i) {
+    if (columns[i].size() != count) {
+      LOG(ERROR) << "AppendRows failed because columns have different length.";
+      return;
+    }
+    if (!data_.empty() && columns[i].type != data_[i].type) {
+      LOG(ERROR) << "AppendRows failed because column type has changed.";
+      return;
+    }
+  }
+  if (count == 0)
+    return;
+
+  if (data_.empty()) {
+    // Take the data directly for the first load.
+    data_ = std::move(columns);
+  } else {
+    for (uint32_t i = 0; i < columns_; ++i) {
+      Column& dest = data_[i];
+      Column& src = columns[i];
+      switch (dest.type) {
+        case Column::Type::Number:
+          dest.numbers.insert(dest.numbers.end(),
+                              src.numbers.begin(), src.numbers.end());
+          break;
+        case Column::Type::Integer:
+          dest.integers.insert(dest.integers.end(),
+                               src.integers.begin(), src.integers.end());
+          break;
+        case Column::Type::String:
+          dest.strings.insert(dest.strings.end(),
+                              std::make_move_iterator(src.strings.begin()),
+                              std::make_move_iterator(src.strings.end()));
+          break;
+      }
+    }
+  }
+
+  uint32_t first = rows_;
+  rows_ += static_cast<uint32_t>(count);
+  NotifyRowsInsertion(first, static_cast<uint32_t>(count));
+}
+
+uint32_t ColumnarTableModel::GetRowCount() const {
+  return rows_;
+}
+
+base::Value ColumnarTableModel::GetValue(uint32_t column, uint32_t row) const {
+  if (column >= data_.size() || row >= rows_)
+    return base::Value();
+  const Column& data = data_[column];
+  switch (data.type) {
+    case Column::Type::Number:
+      return base::Value(data.numbers[row]);
+    case Column::Type::Integer:
+      return base::Value(static_cast<int>(data.integers[row]));
+    case Column::Type::String:
+      return base::Value(data.strings[row]);
+  }
+  NOTREACHED();
+  return base::Value();
+}
+
+void ColumnarTableModel::SetValue(uint32_t column, uint32_t row,
+                                  base::Value value) {
+  if (column >= data_.size() || row >= rows_)
+    return;
+  Column& data = data_[column];
+  switch (data.type) {
+    case Column::Type::Number:
+      if (!value.is_double() && !value.is_int())
+        return;
+      data.numbers[row] = value.GetDouble();
+      break;
+    case Column::Type::Integer:
+      if (!value.is_int())
+        return;
+      data.integers[row] = value.GetInt();
+      break;
+    case Column::Type::String:
+      if (!value.is_string())
+        return;
+      data.strings[row] = std::move(value.GetString());
+      break;
+  }
+  NotifyValueChange(column, row);
+}
+
 }  // namespace nu
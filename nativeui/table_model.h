@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <list>
+#include <string>
 #include <vector>
 
 #include "base/memory/ref_counted.h"
@@ -31,6 +32,7 @@ class NATIVEUI_EXPORT TableModel : public base::RefCounted<TableModel> {
 
   // Called by sublcass to notify when there rows inserted.
   void NotifyRowInsertion(uint32_t row);
+  void NotifyRowsInsertion(uint32_t row, uint32_t count);
   void NotifyRowDeletion(uint32_t row);
   void NotifyValueChange(uint32_t column, uint32_t row);
 
@@ -97,6 +99,58 @@ class NATIVEUI_EXPORT SimpleTableModel : public TableModel {
   std::vector<Row> rows_;
 };
 
+// A TableModel that stores data in typed columns, used for loading large
+// amount of data at once.
+//
+// Cells are only converted to base::Value when the table reads them, so
+// appending rows does not create any base::Value.
+class NATIVEUI_EXPORT ColumnarTableModel : public TableModel {
+ public:
+  struct NATIVEUI_EXPORT Column {
+    enum class Type {
+      Number,
+      Integer,
+      String,
+    };
+
+    Column();
+    explicit Column(std::vector<double> numbers);
+    explicit Column(std::vector<int32_t> integers);
+    explicit Column(std::vector<std::string> strings);
+    Column(Column&& other);
+    ~Column();
+
+    Column& operator=(Column&& other);
+
+    size_t size() const;
+
+    Type type;
+    // Only the vector matching |type| is used.
+    std::vector<double> numbers;
+    std::vector<int32_t> integers;
+    std::vector<std::string> strings;
+  };
+
+  explicit ColumnarTableModel(uint32_t columns);
+
+  // Append rows with column-major data, all columns must have the same length,
+  // and their types must match the columns appended before.
+  void AppendRows(std::vector<Column> columns);
+
+  // TableModel:
+  uint32_t GetRowCount() const override;
+  base::Value GetValue(uint32_t column, uint32_t row) const override;
+  void SetValue(uint32_t column, uint32_t row, base::Value value) override;
+
+ protected:
+  ~ColumnarTableModel() override;
+
+ private:
+  const uint32_t columns_;
+  uint32_t rows_ = 0;
+  std::vector<Column> data_;
+};
+
 }  // namespace nu
 
 #endif  // NATIVEUI_TABLE_MODEL_H_
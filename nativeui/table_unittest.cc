@@ -70,3 +70,88 @@ TEST_F(TableTest, SelectMultipleRows) {
   table_->SelectRows({});
   EXPECT_EQ(table_->GetSelectedRows(), std::set<int>());
 }
+
+class GrowingTableModel : public nu::TableModel {
+ public:
+  GrowingTableModel() {}
+
+  void InsertRows(uint32_t row, uint32_t count) {
+    rows_ += count;
+    NotifyRowsInsertion(row, count);
+  }
+
+  uint32_t GetRowCount() const override {
+    return rows_;
+  }
+
+  base::Value GetValue(uint32_t column, uint32_t row) const override {
+    return base::Value(static_cast<int>(row));
+  }
+
+  void SetValue(uint32_t column, uint32_t row, base::Value value) override {
+  }
+
+ private:
+  ~GrowingTableModel() override {}
+
+  uint32_t rows_ = 100;
+};
+
+#if defined(OS_LINUX) || defined(OS_MAC)
+TEST_F(TableTest, InsertRowsKeepSelection) {
+  scoped_refptr<GrowingTableModel> model = new GrowingTableModel;
+  table_->SetModel(model.get());
+  table_->EnableMultipleSelection(true);
+  table_->SelectRows({10, 50});
+  model->InsertRows(20, 1000);
+  EXPECT_EQ(table_->GetSelectedRows(), std::set<int>({10, 1050}));
+  model->InsertRows(0, 10);
+  EXPECT_EQ(table_->GetSelectedRows(), std::set<int>({20, 1060}));
+}
+#endif
+
+TEST_F(TableTest, ColumnarTableModel) {
+  scoped_refptr<nu::ColumnarTableModel> model = new nu::ColumnarTableModel(3);
+  table_->SetModel(model);
+  std::vector<nu::ColumnarTableModel::Column> columns;
+  columns.emplace_back(std::vector<double>({0.5, 1.5}));
+  columns.emplace_back(std::vector<int32_t>({1, 2}));
+  columns.emplace_back(std::vector<std::string>({"a", "b"}));
+  model->AppendRows(std::move(columns));
+  EXPECT_EQ(model->GetRowCount(), 2u);
+  EXPECT_EQ(model->GetValue(0, 1), base::Value(1.5));
+  EXPECT_EQ(model->GetValue(1, 1), base::Value(2));
+  EXPECT_EQ(model->GetValue(2, 0), base::Value("a"));
+  EXPECT_TRUE(model->GetValue(3, 0).is_none());
+  model->SetValue(2, 0, base::Value("c"));
+  EXPECT_EQ(model->GetValue(2, 0), base::Value("c"));
+  table_->SelectRow(1);
+  // Appending large amount of rows.
+  columns.clear();
+  columns.emplace_back(std::vector<double>(10000, 1.0));
+  columns.emplace_back(std::vector<int32_t>(10000, 2));
+  columns.emplace_back(std::vector<std::string>(10000, "d"));
+  model->AppendRows(std::move(columns));
+  EXPECT_EQ(model->GetRowCount(), 10002u);
+  EXPECT_EQ(model->GetValue(1, 10001), base::Value(2));
+  EXPECT_EQ(table_->GetSelectedRow(), 1);
+}
+
+TEST_F(TableTest, ColumnarTableModelMismatch) {
+  scoped_refptr<nu::ColumnarTableModel> model = new nu::ColumnarTableModel(2);
+  std::vector<nu::ColumnarTableModel::Column> columns;
+  columns.emplace_back(std::vector<double>({1, 2}));
+  columns.emplace_back(std::vector<double>({1}));
+  model->AppendRows(std::move(columns));
+  EXPECT_EQ(model->GetRowCount(), 0u);
+  columns.clear();
+  columns.emplace_back(std::vector<double>({1}));
+  columns.emplace_back(std::vector<double>({1}));
+  model->AppendRows(std::move(columns));
+  EXPECT_EQ(model->GetRowCount(), 1u);
+  columns.clear();
+  columns.emplace_back(std::vector<double>({1}));
+  columns.emplace_back(std::vector<std::string>({"str"}));
+  model->AppendRows(std::move(columns));
+  EXPECT_EQ(model->GetRowCount(), 1u);
+}
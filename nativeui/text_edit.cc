@@ -4,8 +4,43 @@
 
 #include "nativeui/text_edit.h"
 
+#include <algorithm>
+#include <utility>
+
+#include "base/files/file.h"
+#include "base/files/memory_mapped_file.h"
+#include "nativeui/buffer.h"
+#include "nativeui/message_loop.h"
+
 namespace nu {
 
+namespace {
+
+// Text is appended in chunks, so the message loop can run between chunks when
+// loading files.
+constexpr size_t kLoadChunkSize = 1024 * 1024;
+
+// Return the end of chunk starting at |start|, which does not split UTF-8
+// sequences.
+size_t GetChunkEnd(const char* data, size_t start, size_t size) {
+  size_t max_end = std::min(start + kLoadChunkSize, size);
+  size_t end = max_end;
+  while (end < size && end > start &&
+         (static_cast<uint8_t>(data[end]) & 0xC0) == 0x80)
+    --end;
+  return end > start ? end : max_end;
+}
+
+}  // namespace
+
+// The state of loading a file.
+struct TextEdit::FileLoader {
+  base::MemoryMappedFile file;
+  size_t offset = 0;
+  int id = 0;
+  LoadProgress progress;
+};
+
 // static
 const char TextEdit::kClassName[] = "TextEdit";
 
@@ -13,4 +48,79 @@ const char* TextEdit::GetClassName() const {
   return kClassName;
 }
 
+void TextEdit::LoadBuffer(const Buffer& buffer, const LoadProgress& progress) {
+  CancelLoad();
+  int id = ++load_id_;
+  is_loading_ = true;
+  const char* data = static_cast<const char*>(buffer.content());
+  size_t size = buffer.size();
+  PlatformBeginLoad();
+  for (size_t offset = 0; offset < size;) {
+    size_t end = GetChunkEnd(data, offset, size);
+    PlatformAppendText(data + offset, end - offset);
+    offset = end;
+    if (progress && offset < size) {
+      progress(this, static_cast<float>(offset) / size);
+      if (id != load_id_)  // cancelled in callback
+        return;
+    }
+  }
+  is_loading_ = false;
+  PlatformEndLoad();
+  if (progress)
+    progress(this, 1.f);
+}
+
+bool TextEdit::LoadFile(const base::FilePath& path, LoadProgress progress) {
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid())
+    return false;
+  // Empty files can not be mapped.
+  if (file.GetLength() == 0) {
+    LoadBuffer(Buffer(), progress);
+    return true;
+  }
+  auto loader = std::make_shared<FileLoader>();
+  if (!loader->file.Initialize(std::move(file)))
+    return false;
+  CancelLoad();
+  loader->id = ++load_id_;
+  loader->progress = std::move(progress);
+  is_loading_ = true;
+  PlatformBeginLoad();
+  LoadNextChunk(std::move(loader));
+  return true;
+}
+
+void TextEdit::LoadNextChunk(std::shared_ptr<FileLoader> loader) {
+  if (loader->id != load_id_)  // cancelled
+    return;
+  const char* data = reinterpret_cast<const char*>(loader->file.data());
+  size_t size = loader->file.length();
+  size_t end = GetChunkEnd(data, loader->offset, size);
+  PlatformAppendText(data + loader->offset, end - loader->offset);
+  loader->offset = end;
+  if (end < size) {
+    scoped_refptr<TextEdit> self(this);
+    MessageLoop::PostTask([self, loader]() {
+      self->LoadNextChunk(loader);
+    });
+    if (loader->progress)
+      loader->progress(this, static_cast<float>(end) / size);
+  } else {
+    is_loading_ = false;
+    PlatformEndLoad();
+    if (loader->progress)
+      loader->progress(this, 1.f);
+  }
+}
+
+void TextEdit::CancelLoad() {
+  if (!is_loading_)
+    return;
+  ++load_id_;
+  is_loading_ = false;
+  PlatformEndLoad();
+}
+
 }  // namespace nu
@@ -5,17 +5,33 @@
 #ifndef NATIVEUI_TEXT_EDIT_H_
 #define NATIVEUI_TEXT_EDIT_H_
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <tuple>
 
 #include "nativeui/scroll.h"
 
+namespace base {
+class FilePath;
+}
+
 namespace nu {
 
+class Buffer;
+
 class NATIVEUI_EXPORT TextEdit : public View {
  public:
   TextEdit();
 
+  // Describes a change of text, |offset| and |deleted_length| are in the
+  // same unit with the positions used by SelectRange.
+  struct TextDelta {
+    int offset = 0;
+    int deleted_length = 0;
+    std::string inserted_text;
+  };
+
   // View class name.
   static const char kClassName[];
 
@@ -25,10 +41,33 @@ class NATIVEUI_EXPORT TextEdit : public View {
   void SetText(const std::string& text);
   std::string GetText() const;
 
+  // Called with the ratio of loaded bytes, the last call is always made with
+  // 1.0 when loading is done.
+  using LoadProgress = std::function<void(TextEdit*, float progress)>;
+
+  // Replace the text with UTF-8 content, which is appended in chunks. While
+  // loading the text can not be edited by user, the undo history is not
+  // recorded and is cleared at last, and neither on_text_change nor
+  // on_text_delta is emitted.
+  //
+  // The |buffer| is fully read before LoadBuffer returns.
+  void LoadBuffer(const Buffer& buffer, const LoadProgress& progress = nullptr);
+  // The file is memory mapped instead of read into memory, and its chunks are
+  // appended asynchronously in the message loop. Return false if the file can
+  // not be opened. Calling SetText or loading other content cancels it.
+  bool LoadFile(const base::FilePath& path, LoadProgress progress = nullptr);
+  bool IsLoading() const { return is_loading_; }
+
   void Redo();
   bool CanRedo() const;
   void Undo();
   bool CanUndo() const;
+#if defined(OS_LINUX)
+  // Only GTK keeps its own undo history, these are C++ only APIs that are not
+  // exposed to language bindings.
+  void SetUndoLimits(size_t max_bytes, size_t max_groups);
+  size_t GetUndoMemoryUsage() const;
+#endif
 
   void Cut();
   void Copy();
@@ -38,6 +77,9 @@ class NATIVEUI_EXPORT TextEdit : public View {
   std::tuple<int, int> GetSelectionRange() const;
   void SelectRange(int start, int end);
   std::string GetTextInRange(int start, int end) const;
+  // Read the text in range into |out|, its memory is reused when possible.
+  void ReadRange(int start, int end, std::string* out) const;
+  int GetTextLength() const;
   void InsertText(const std::string& text);
   void InsertTextAt(const std::string& text, int pos);
   void Delete();
@@ -58,12 +100,31 @@ class NATIVEUI_EXPORT TextEdit : public View {
 
   // Events.
   Signal<void(TextEdit*)> on_text_change;
+  // Not emitted on Windows.
+  Signal<void(TextEdit*, const TextDelta&)> on_text_delta;
 
   // Delegate methods.
   std::function<bool(TextEdit*)> should_insert_new_line;
 
  protected:
   ~TextEdit() override;
+
+ private:
+  struct FileLoader;
+
+  void LoadNextChunk(std::shared_ptr<FileLoader> loader);
+  void CancelLoad();
+
+  // Platform implementations of loading.
+  void PlatformBeginLoad();
+  void PlatformAppendText(const char* text, size_t length);
+  void PlatformEndLoad();
+
+  // Increased for each loading, so pending chunks can tell if they are stale.
+  int load_id_ = 0;
+  bool is_loading_ = false;
+  // The native widget is made read-only while loading, restore it after.
+  bool read_only_before_load_ = false;
 };
 
 }  // namespace nu
@@ -2,6 +2,11 @@
 // Use of this source code is governed by the license that can be found in the
 // LICENSE file.
 
+#include <string>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
 #include "nativeui/nativeui.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -96,3 +101,102 @@ TEST_F(TextEditTest, Undo) {
   EXPECT_EQ(edit_->CanUndo(), true);
   EXPECT_EQ(edit_->CanRedo(), false);
 }
+
+TEST_F(TextEditTest, ReadRange) {
+  edit_->SetText("abcdefg");
+  EXPECT_EQ(edit_->GetTextLength(), 7);
+  std::string chunk;
+  edit_->ReadRange(0, 3, &chunk);
+  EXPECT_EQ(chunk, "abc");
+  edit_->ReadRange(3, 7, &chunk);
+  EXPECT_EQ(chunk, "defg");
+  edit_->SetText("a\xE4\xBD\xA0b");
+  edit_->ReadRange(1, 2, &chunk);
+  EXPECT_EQ(chunk, "\xE4\xBD\xA0");
+}
+
+#if !defined(OS_WIN)
+TEST_F(TextEditTest, TextDelta) {
+  std::vector<nu::TextEdit::TextDelta> deltas;
+  edit_->on_text_delta.Connect([&deltas](nu::TextEdit*,
+                                         const nu::TextEdit::TextDelta& d) {
+    deltas.push_back(d);
+  });
+  edit_->SetText("abd");
+  deltas.clear();
+  edit_->InsertTextAt("c", 2);
+  ASSERT_EQ(deltas.size(), 1u);
+  EXPECT_EQ(deltas[0].offset, 2);
+  EXPECT_EQ(deltas[0].deleted_length, 0);
+  EXPECT_EQ(deltas[0].inserted_text, "c");
+  deltas.clear();
+  edit_->DeleteRange(0, 2);
+  ASSERT_EQ(deltas.size(), 1u);
+  EXPECT_EQ(deltas[0].offset, 0);
+  EXPECT_EQ(deltas[0].deleted_length, 2);
+  EXPECT_EQ(deltas[0].inserted_text, "");
+  EXPECT_EQ(edit_->GetText(), "cd");
+}
+#endif
+
+TEST_F(TextEditTest, LoadBuffer) {
+  edit_->SetText("old");
+  edit_->InsertText("er");
+  bool changed = false;
+  edit_->on_text_change.Connect([&changed](nu::TextEdit*) { changed = true; });
+  // Multi-byte characters spanning multiple chunks.
+  std::string content;
+  for (int i = 0; i < 500000; ++i)
+    content += "\xE4\xBD\xA0";
+  std::vector<float> progress;
+  edit_->LoadBuffer(nu::Buffer::Wrap(content.data(), content.size()),
+                    [&progress](nu::TextEdit*, float ratio) {
+    progress.push_back(ratio);
+  });
+  EXPECT_FALSE(changed);
+  EXPECT_FALSE(edit_->CanUndo());
+  ASSERT_GT(progress.size(), 1u);
+  EXPECT_EQ(progress.back(), 1.f);
+  EXPECT_EQ(edit_->GetTextLength(), 500000);
+  EXPECT_EQ(edit_->GetText(), content);
+}
+
+TEST_F(TextEditTest, LoadFile) {
+  base::ScopedTempDir dir;
+  ASSERT_TRUE(dir.CreateUniqueTempDir());
+  base::FilePath path = dir.GetPath().Append(FILE_PATH_LITERAL("text"));
+  std::string content(3 * 1024 * 1024 + 1, 'a');
+  base::WriteFile(path, content.c_str(), static_cast<int>(content.size()));
+  int calls = 0;
+  ASSERT_TRUE(edit_->LoadFile(path, [&calls](nu::TextEdit*, float ratio) {
+    ++calls;
+    if (ratio == 1.f)
+      nu::MessageLoop::Quit();
+  }));
+  EXPECT_TRUE(edit_->IsLoading());
+  nu::MessageLoop::Run();
+  EXPECT_FALSE(edit_->IsLoading());
+  EXPECT_EQ(calls, 4);
+  EXPECT_EQ(edit_->GetTextLength(), static_cast<int>(content.size()));
+  EXPECT_FALSE(edit_->LoadFile(dir.GetPath().Append(FILE_PATH_LITERAL("no")),
+                               nullptr));
+}
+
+TEST_F(TextEditTest, SetTextCancelsLoadFile) {
+  base::ScopedTempDir dir;
+  ASSERT_TRUE(dir.CreateUniqueTempDir());
+  base::FilePath path = dir.GetPath().Append(FILE_PATH_LITERAL("text"));
+  std::string content(2 * 1024 * 1024, 'a');
+  base::WriteFile(path, content.c_str(), static_cast<int>(content.size()));
+  // Only the first chunk is loaded.
+  int calls = 0;
+  ASSERT_TRUE(edit_->LoadFile(path, [&calls](nu::TextEdit*, float) {
+    ++calls;
+  }));
+  edit_->SetText("text");
+  EXPECT_FALSE(edit_->IsLoading());
+  nu::MessageLoop::PostTask([]() { nu::MessageLoop::Quit(); });
+  nu::MessageLoop::Run();
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(edit_->GetText(), "text");
+}
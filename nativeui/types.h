@@ -30,12 +30,14 @@ typedef struct _GDBusProxy GDBusProxy;
 typedef struct _PangoFontDescription PangoFontDescription;
 typedef struct _PangoLayout PangoLayout;
 typedef struct _cairo_surface cairo_surface_t;
+typedef struct cairo_path cairo_path_t;
 typedef struct _cairo cairo_t;
 typedef union _GdkEvent GdkEvent;
 #endif
 
 #if defined(OS_MAC)
 typedef struct CGContext* CGContextRef;
+typedef struct CGPath* CGMutablePathRef;
 #ifdef __OBJC__
 @class NSMutableAttributedString;
 @class NSAlert;
@@ -85,6 +87,7 @@ class NUNotificationCenterDelegate;
 namespace Gdiplus {
 class Font;
 class Graphics;
+class GraphicsPath;
 class Image;
 }
 #endif
@@ -127,6 +130,7 @@ using NativeMenu = NSMenu*;
 using NativeMenuItem = NSMenuItem*;
 using NativeNotification = NSUserNotification*;
 using NativeNotificationCenter = NUNotificationCenterDelegate*;
+using NativePath = CGMutablePathRef;
 using NativeResponder = NSResponder*;
 using NativeToolbar = NSToolbar*;
 using NativeTray = NSStatusItem*;
@@ -148,6 +152,7 @@ using NativeMenu = GtkMenuShell*;
 using NativeMenuItem = GtkMenuItem*;
 using NativeNotification = NotificationData*;
 using NativeNotificationCenter = GDBusProxy*;
+using NativePath = cairo_path_t*;
 using NativeResponder = GtkWidget*;
 using NativeTray = AppIndicator*;
 #elif defined(OS_WIN)
@@ -168,6 +173,7 @@ using NativeMenu = HMENU;
 using NativeMenuItem = MenuItemData*;
 using NativeNotification = NotificationImpl*;
 using NativeNotificationCenter = ComServerModule*;
+using NativePath = Gdiplus::GraphicsPath*;
 using NativeResponder = ResponderImpl*;
 using NativeTray = TrayImpl*;
 #endif
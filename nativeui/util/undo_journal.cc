@@ -0,0 +1,214 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/util/undo_journal.h"
+
+#include "base/check_op.h"
+
+namespace nu {
+
+// static
+constexpr size_t UndoJournal::kDefaultMaxBytes;
+constexpr size_t UndoJournal::kDefaultMaxGroups;
+
+UndoJournal::UndoJournal() {}
+
+UndoJournal::~UndoJournal() {}
+
+void UndoJournal::BeginGroup() {
+  if (group_depth_++ > 0)
+    return;
+  current_group_ = next_group_++;
+  group_entry_count_ = 0;
+  group_is_typing_ = false;
+}
+
+void UndoJournal::EndGroup() {
+  DCHECK_GT(group_depth_, 0);
+  // Ignore unbalanced calls in release builds.
+  if (group_depth_ <= 0) {
+    group_depth_ = 0;
+    return;
+  }
+  if (--group_depth_ > 0)
+    return;
+  if (group_entry_count_ > 0)
+    last_group_is_typing_ = group_is_typing_ && group_entry_count_ == 1;
+  Evict();
+}
+
+void UndoJournal::RecordInsert(int offset, base::StringPiece text, int length) {
+  Record(Type::Insert, offset, text, length, false);
+}
+
+void UndoJournal::RecordDelete(int offset, base::StringPiece text, int length,
+                               bool is_delete_key) {
+  Record(Type::Delete, offset, text, length, is_delete_key);
+}
+
+bool UndoJournal::Undo(std::vector<Edit>* edits) {
+  if (!CanUndo())
+    return false;
+  size_t end = undo_count_;
+  uint32_t group = entries_[end - 1].group;
+  size_t begin = end - 1;
+  while (begin > 0 && entries_[begin - 1].group == group)
+    --begin;
+  CollectGroup(begin, end, edits);
+  undo_count_ = begin;
+  last_group_is_typing_ = false;
+  return true;
+}
+
+bool UndoJournal::Redo(std::vector<Edit>* edits) {
+  if (!CanRedo())
+    return false;
+  size_t begin = undo_count_;
+  uint32_t group = entries_[begin].group;
+  size_t end = begin + 1;
+  while (end < entries_.size() && entries_[end].group == group)
+    ++end;
+  CollectGroup(begin, end, edits);
+  undo_count_ = end;
+  last_group_is_typing_ = false;
+  return true;
+}
+
+void UndoJournal::Clear() {
+  entries_.clear();
+  undo_count_ = 0;
+  group_count_ = 0;
+  arena_.clear();
+  arena_.shrink_to_fit();
+  arena_start_ = 0;
+  group_entry_count_ = 0;
+  last_group_is_typing_ = false;
+}
+
+void UndoJournal::SetLimits(size_t max_bytes, size_t max_groups) {
+  max_bytes_ = max_bytes;
+  max_groups_ = max_groups;
+  Evict();
+}
+
+size_t UndoJournal::GetMemoryUsage() const {
+  return arena_.capacity() + entries_.size() * sizeof(Entry);
+}
+
+void UndoJournal::Record(Type type, int offset, base::StringPiece text,
+                         int length, bool is_delete_key) {
+  // Edits out of groups are in their own groups.
+  if (group_depth_ == 0) {
+    BeginGroup();
+    Record(type, offset, text, length, is_delete_key);
+    EndGroup();
+    return;
+  }
+
+  DropRedo();
+  Entry entry = {type, is_delete_key, offset, length, current_group_,
+                 arena_start_ + arena_.size(), text.size()};
+  arena_.append(text.data(), text.size());
+
+  // Single characters typed as a user action can join last typing.
+  bool is_typing = group_entry_count_ == 0 && length == 1 && text != "\n";
+  if (is_typing && TryCoalesce(&entry)) {
+    current_group_ = entry.group;
+    group_entry_count_ = 1;
+    group_is_typing_ = true;
+    return;
+  }
+
+  if (group_entry_count_++ == 0)
+    ++group_count_;
+  group_is_typing_ = is_typing;
+  entries_.push_back(entry);
+  undo_count_ = entries_.size();
+}
+
+void UndoJournal::DropRedo() {
+  if (!CanRedo())
+    return;
+  arena_.resize(entries_[undo_count_].text_start - arena_start_);
+  for (size_t i = undo_count_; i < entries_.size(); ++i) {
+    if (i == undo_count_ || entries_[i].group != entries_[i - 1].group)
+      --group_count_;
+  }
+  entries_.resize(undo_count_);
+}
+
+bool UndoJournal::TryCoalesce(Entry* entry) {
+  if (!last_group_is_typing_ || entries_.empty())
+    return false;
+  Entry& last = entries_.back();
+  if (last.type != entry->type || last.is_delete_key != entry->is_delete_key)
+    return false;
+  if (entry->type == Type::Insert ||
+      (entry->type == Type::Delete && entry->is_delete_key)) {
+    // Text is appended to the last edit, which is at the end of arena.
+    if ((entry->type == Type::Insert &&
+         entry->offset != last.offset + last.length) ||
+        (entry->type == Type::Delete && entry->offset != last.offset))
+      return false;
+    last.length += entry->length;
+    last.text_size += entry->text_size;
+    entry->group = last.group;
+    return true;
+  }
+  // Backspace deletes text in reverse order, keep it as a separate edit in the
+  // same group.
+  if (entry->offset + entry->length != last.offset)
+    return false;
+  entry->group = last.group;
+  entries_.push_back(*entry);
+  undo_count_ = entries_.size();
+  return true;
+}
+
+void UndoJournal::Evict() {
+  while (undo_count_ > 0) {
+    size_t live_bytes = arena_start_ + arena_.size() -
+                        entries_.front().text_start;
+    if (live_bytes <= max_bytes_ && group_count_ <= max_groups_)
+      break;
+    // Never evict the group being recorded.
+    uint32_t group = entries_.front().group;
+    if (group_depth_ > 0 && group == current_group_)
+      break;
+    while (undo_count_ > 0 && entries_.front().group == group) {
+      entries_.pop_front();
+      --undo_count_;
+    }
+    --group_count_;
+  }
+
+  // Release the text of evicted entries when they take more than half of the
+  // arena.
+  size_t live_start = entries_.empty() ? arena_start_ + arena_.size()
+                                       : entries_.front().text_start;
+  size_t dead_bytes = live_start - arena_start_;
+  if (dead_bytes > 0 && dead_bytes >= arena_.size() / 2) {
+    arena_.erase(0, dead_bytes);
+    arena_start_ += dead_bytes;
+    if (arena_.capacity() > 2 * arena_.size())
+      arena_.shrink_to_fit();
+  }
+}
+
+UndoJournal::Edit UndoJournal::ToEdit(const Entry& entry) const {
+  return {entry.type, entry.offset, entry.length,
+          base::StringPiece(arena_.data() + entry.text_start - arena_start_,
+                            entry.text_size),
+          entry.is_delete_key};
+}
+
+void UndoJournal::CollectGroup(size_t begin,
+                               size_t end,
+                               std::vector<Edit>* edits) const {
+  edits->clear();
+  for (size_t i = begin; i < end; ++i)
+    edits->push_back(ToEdit(entries_[i]));
+}
+
+}  // namespace nu
@@ -0,0 +1,121 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_UTIL_UNDO_JOURNAL_H_
+#define NATIVEUI_UTIL_UNDO_JOURNAL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+#include "nativeui/nativeui_export.h"
+
+namespace nu {
+
+// Records text edits for undo and redo.
+//
+// Edits are recorded in groups, and undo/redo always work on a whole group.
+// Adjacent typing of single characters is coalesced into one group, and the
+// text of all edits is stored in one append-only arena. When the limits are
+// exceeded the oldest groups are evicted.
+class NATIVEUI_EXPORT UndoJournal {
+ public:
+  enum class Type {
+    Insert,
+    Delete,
+  };
+
+  // An edit returned by Undo and Redo, the |text| is only valid until the
+  // journal is modified.
+  struct Edit {
+    Type type;
+    int offset;
+    int length;  // in characters
+    base::StringPiece text;
+    bool is_delete_key;  // whether deleted with Delete key or Backspace
+  };
+
+  static constexpr size_t kDefaultMaxBytes = 8 * 1024 * 1024;
+  static constexpr size_t kDefaultMaxGroups = 10000;
+
+  UndoJournal();
+  ~UndoJournal();
+
+  // Edits recorded between BeginGroup and EndGroup are undone together.
+  // Edits recorded outside a group are each put in its own group.
+  void BeginGroup();
+  void EndGroup();
+
+  // Record edits, the |length| is the number of characters in |text|.
+  void RecordInsert(int offset, base::StringPiece text, int length);
+  void RecordDelete(int offset, base::StringPiece text, int length,
+                    bool is_delete_key);
+
+  // Return the edits of the group to undo or redo, in the order they were
+  // recorded. Return false if there is nothing to undo or redo.
+  bool Undo(std::vector<Edit>* edits);
+  bool Redo(std::vector<Edit>* edits);
+
+  bool CanUndo() const { return undo_count_ > 0; }
+  bool CanRedo() const { return undo_count_ < entries_.size(); }
+
+  // Drop all undo and redo history.
+  void Clear();
+
+  // Limit the text bytes and the number of groups stored.
+  void SetLimits(size_t max_bytes, size_t max_groups);
+
+  // Return the bytes of memory used by the journal.
+  size_t GetMemoryUsage() const;
+
+  size_t GetGroupCount() const { return group_count_; }
+
+ private:
+  struct Entry {
+    Type type;
+    bool is_delete_key;
+    int offset;
+    int length;
+    uint32_t group;
+    size_t text_start;  // position in arena, including evicted bytes
+    size_t text_size;
+  };
+
+  void Record(Type type, int offset, base::StringPiece text, int length,
+              bool is_delete_key);
+  void DropRedo();
+  bool TryCoalesce(Entry* entry);
+  void Evict();
+  Edit ToEdit(const Entry& entry) const;
+  void CollectGroup(size_t begin, size_t end, std::vector<Edit>* edits) const;
+
+  std::deque<Entry> entries_;
+  // Entries before this index can be undone, the rest can be redone.
+  size_t undo_count_ = 0;
+  size_t group_count_ = 0;
+
+  // Text of all entries, |arena_start_| is the number of evicted bytes.
+  std::string arena_;
+  size_t arena_start_ = 0;
+
+  // The group being recorded.
+  uint32_t next_group_ = 0;
+  uint32_t current_group_ = 0;
+  int group_depth_ = 0;
+  int group_entry_count_ = 0;
+  bool group_is_typing_ = false;
+  // Whether the last group is typing that later typing can join.
+  bool last_group_is_typing_ = false;
+
+  size_t max_bytes_ = kDefaultMaxBytes;
+  size_t max_groups_ = kDefaultMaxGroups;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_UTIL_UNDO_JOURNAL_H_
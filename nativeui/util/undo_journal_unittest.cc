@@ -0,0 +1,98 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "nativeui/util/undo_journal.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class UndoJournalTest : public testing::Test {
+ protected:
+  void Type(const std::string& text) {
+    for (char c : text) {
+      int offset = static_cast<int>(document_.size());
+      journal_.BeginGroup();
+      document_.push_back(c);
+      journal_.RecordInsert(offset, std::string(1, c), 1);
+      journal_.EndGroup();
+    }
+  }
+
+  void Backspace() {
+    int offset = static_cast<int>(document_.size()) - 1;
+    std::string text = document_.substr(offset);
+    document_.pop_back();
+    journal_.BeginGroup();
+    journal_.RecordDelete(offset, text, 1, false);
+    journal_.EndGroup();
+  }
+
+  void Undo() {
+    std::vector<nu::UndoJournal::Edit> edits;
+    ASSERT_TRUE(journal_.Undo(&edits));
+    for (auto it = edits.rbegin(); it != edits.rend(); ++it) {
+      if (it->type == nu::UndoJournal::Type::Insert)
+        document_.erase(it->offset, it->length);
+      else
+        document_.insert(it->offset, std::string(it->text));
+    }
+  }
+
+  void Redo() {
+    std::vector<nu::UndoJournal::Edit> edits;
+    ASSERT_TRUE(journal_.Redo(&edits));
+    for (const auto& edit : edits) {
+      if (edit.type == nu::UndoJournal::Type::Insert)
+        document_.insert(edit.offset, std::string(edit.text));
+      else
+        document_.erase(edit.offset, edit.length);
+    }
+  }
+
+  std::string document_;
+  nu::UndoJournal journal_;
+};
+
+TEST_F(UndoJournalTest, CoalesceTyping) {
+  Type("hello\nworld");
+  EXPECT_EQ(journal_.GetGroupCount(), 3u);
+  Backspace();
+  Backspace();
+  EXPECT_EQ(journal_.GetGroupCount(), 4u);
+  Undo();
+  EXPECT_EQ(document_, "hello\nworld");
+  Undo();
+  EXPECT_EQ(document_, "hello\n");
+  Undo();
+  EXPECT_EQ(document_, "hello");
+  Redo();
+  EXPECT_EQ(document_, "hello\n");
+  Undo();
+  Undo();
+  EXPECT_EQ(document_, "");
+  EXPECT_FALSE(journal_.CanUndo());
+  EXPECT_TRUE(journal_.CanRedo());
+}
+
+TEST_F(UndoJournalTest, RecordDropsRedo) {
+  Type("ab");
+  Undo();
+  EXPECT_TRUE(journal_.CanRedo());
+  journal_.RecordInsert(0, "c", 1);
+  EXPECT_FALSE(journal_.CanRedo());
+  EXPECT_EQ(journal_.GetGroupCount(), 1u);
+}
+
+TEST_F(UndoJournalTest, EvictOldest) {
+  journal_.RecordInsert(0, std::string(1000, 'x'), 1000);
+  size_t usage = journal_.GetMemoryUsage();
+  EXPECT_GE(usage, 1000u);
+  journal_.SetLimits(100, 10);
+  EXPECT_FALSE(journal_.CanUndo());
+  EXPECT_LT(journal_.GetMemoryUsage(), usage);
+  for (int i = 0; i < 30; ++i)
+    journal_.RecordInsert(0, "ab", 2);
+  EXPECT_EQ(journal_.GetGroupCount(), 10u);
+}
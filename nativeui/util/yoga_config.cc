@@ -0,0 +1,39 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/util/yoga_config.h"
+
+#include "nativeui/state.h"
+#include "third_party/yoga/yoga/Yoga.h"
+
+namespace nu {
+
+// static
+scoped_refptr<YogaConfig> YogaConfig::Get(float scale_factor) {
+  auto& configs = State::GetCurrent()->yoga_configs();
+  auto it = configs.find(scale_factor);
+  if (it != configs.end())
+    return it->second;
+  return new YogaConfig(scale_factor);
+}
+
+YogaConfig::YogaConfig(float scale_factor)
+    : scale_factor_(scale_factor), config_(YGConfigNew()) {
+  YGConfigSetPointScaleFactor(config_, scale_factor_);
+  State::GetCurrent()->yoga_configs()[scale_factor_] = this;
+}
+
+YogaConfig::~YogaConfig() {
+  // Views released after State is destroyed do not have a map to update.
+  State* state = State::GetCurrent();
+  if (state) {
+    auto& configs = state->yoga_configs();
+    auto it = configs.find(scale_factor_);
+    if (it != configs.end() && it->second == this)
+      configs.erase(it);
+  }
+  YGConfigFree(config_);
+}
+
+}  // namespace nu
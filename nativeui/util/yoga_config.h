@@ -0,0 +1,39 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_UTIL_YOGA_CONFIG_H_
+#define NATIVEUI_UTIL_YOGA_CONFIG_H_
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/nativeui_export.h"
+
+typedef struct YGConfig *YGConfigRef;
+
+namespace nu {
+
+// A YGConfig shared by views.
+//
+// Configs are interned in State by their settings, so views in the same
+// window, or in windows of the same scale factor, share one instance.
+class NATIVEUI_EXPORT YogaConfig : public base::RefCounted<YogaConfig> {
+ public:
+  // Return the shared config for |scale_factor|.
+  static scoped_refptr<YogaConfig> Get(float scale_factor);
+
+  YGConfigRef get() const { return config_; }
+  float scale_factor() const { return scale_factor_; }
+
+ private:
+  friend class base::RefCounted<YogaConfig>;
+
+  explicit YogaConfig(float scale_factor);
+  ~YogaConfig();
+
+  float scale_factor_;
+  YGConfigRef config_;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_UTIL_YOGA_CONFIG_H_
@@ -4,13 +4,12 @@
 
 #include "nativeui/util/yoga_util.h"
 
-#include <algorithm>
-#include <tuple>
-#include <utility>
+#include <iterator>
 
 #include "base/logging.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "nativeui/style_property.h"
 #include "third_party/yoga/yoga/Yoga.h"
 
 namespace nu {
@@ -167,205 +166,143 @@ using FloatSetter = void(*)(const YGNodeRef, float);
 using AutoSetter = void(*)(const YGNodeRef);
 using EdgeSetter = void(*)(const YGNodeRef, const YGEdge, float);
 
-// Sorted list of CSS node properties.
-const std::tuple<const char*, IntConverter, IntSetter> int_setters[] = {
-  { "aligncontent", AlignValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetAlignContent) },
-  { "alignitems", AlignValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetAlignItems) },
-  { "alignself", AlignValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetAlignSelf) },
-  { "direction", DirectionValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetDirection) },
-  { "display", DisplayValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetDisplay) },
-  { "flexdirection", FlexDirectionValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetFlexDirection) },
-  { "flexwrap", WrapValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetFlexWrap) },
-  { "justifycontent", JustifyValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetJustifyContent) },
-  { "overflow", OverflowValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetOverflow) },
-  { "position", PositionValue,
-    reinterpret_cast<IntSetter>(YGNodeStyleSetPositionType) },
-};
-const std::pair<const char*, FloatSetter> float_setters[] = {
-  { "aspectratio", YGNodeStyleSetAspectRatio },
-  { "columngap", YGNodeStyleSetGapColumn },
-  { "flex", YGNodeStyleSetFlex },
-  { "flexbasis", YGNodeStyleSetFlexBasis },
-  { "flexgrow", YGNodeStyleSetFlexGrow },
-  { "flexshrink", YGNodeStyleSetFlexShrink },
-  { "gap", YGNodeStyleSetGapAll },
-  { "height", YGNodeStyleSetHeight },
-  { "maxheight", YGNodeStyleSetMaxHeight },
-  { "maxwidth", YGNodeStyleSetMaxWidth },
-  { "minheight", YGNodeStyleSetMinHeight },
-  { "minwidth", YGNodeStyleSetMinWidth },
-  { "rowgap", YGNodeStyleSetGapRow },
-  { "width", YGNodeStyleSetWidth },
-};
-const std::pair<const char*, AutoSetter> auto_setters[] = {
-  { "flexbasis", YGNodeStyleSetFlexBasisAuto},
-  { "height", YGNodeStyleSetHeightAuto},
-  { "width", YGNodeStyleSetWidthAuto},
-};
-const std::pair<const char*, FloatSetter> percent_setters[] = {
-  { "flexbasis", YGNodeStyleSetFlexBasisPercent },
-  { "height", YGNodeStyleSetHeightPercent },
-  { "maxheight", YGNodeStyleSetMaxHeightPercent },
-  { "maxwidth", YGNodeStyleSetMaxWidthPercent },
-  { "minheight", YGNodeStyleSetMinHeightPercent },
-  { "minwidth", YGNodeStyleSetMinWidthPercent },
-  { "width", YGNodeStyleSetWidthPercent },
-};
-const std::tuple<const char*, YGEdge, EdgeSetter> edge_setters[] = {
-  { "border", YGEdgeAll, YGNodeStyleSetBorder },
-  { "borderbottom", YGEdgeBottom, YGNodeStyleSetBorder },
-  { "borderleft", YGEdgeLeft, YGNodeStyleSetBorder },
-  { "borderright", YGEdgeRight, YGNodeStyleSetBorder },
-  { "bordertop", YGEdgeTop, YGNodeStyleSetBorder },
-  { "bottom", YGEdgeBottom, YGNodeStyleSetPosition },
-  { "left", YGEdgeLeft, YGNodeStyleSetPosition },
-  { "margin", YGEdgeAll, YGNodeStyleSetMargin },
-  { "marginbottom", YGEdgeBottom, YGNodeStyleSetMargin },
-  { "marginleft", YGEdgeLeft, YGNodeStyleSetMargin },
-  { "marginright", YGEdgeRight, YGNodeStyleSetMargin },
-  { "margintop", YGEdgeTop, YGNodeStyleSetMargin },
-  { "padding", YGEdgeAll, YGNodeStyleSetPadding },
-  { "paddingbottom", YGEdgeBottom, YGNodeStyleSetPadding },
-  { "paddingleft", YGEdgeLeft, YGNodeStyleSetPadding },
-  { "paddingright", YGEdgeRight, YGNodeStyleSetPadding },
-  { "paddingtop", YGEdgeTop, YGNodeStyleSetPadding },
-  { "right", YGEdgeRight, YGNodeStyleSetPosition },
-  { "top", YGEdgeTop, YGNodeStyleSetPosition },
-};
-const std::tuple<const char*, YGEdge, EdgeSetter> edge_percent_setters[] = {
-  { "bottom", YGEdgeBottom, YGNodeStyleSetPositionPercent },
-  { "left", YGEdgeLeft, YGNodeStyleSetPositionPercent },
-  { "margin", YGEdgeAll, YGNodeStyleSetMarginPercent },
-  { "marginbottom", YGEdgeBottom, YGNodeStyleSetMarginPercent },
-  { "marginleft", YGEdgeLeft, YGNodeStyleSetMarginPercent },
-  { "marginright", YGEdgeRight, YGNodeStyleSetMarginPercent },
-  { "margintop", YGEdgeTop, YGNodeStyleSetMarginPercent },
-  { "padding", YGEdgeAll, YGNodeStyleSetPaddingPercent },
-  { "paddingbottom", YGEdgeBottom, YGNodeStyleSetPaddingPercent },
-  { "paddingleft", YGEdgeLeft, YGNodeStyleSetPaddingPercent },
-  { "paddingright", YGEdgeRight, YGNodeStyleSetPaddingPercent },
-  { "paddingtop", YGEdgeTop, YGNodeStyleSetPaddingPercent },
-  { "right", YGEdgeRight, YGNodeStyleSetPositionPercent },
-  { "top", YGEdgeTop, YGNodeStyleSetPositionPercent },
+// How the value of a property is set.
+enum class SetterType {
+  None,  // not a layout property
+  Int,   // enum values
+  Unit,  // float, percent or "auto"
+  Edge,  // float or percent for an edge
 };
 
-// Compare function to compare elements.
-template<typename T>
-bool ElementCompare(const T& e1, const T& e2) {
-  return base::StringPiece(std::get<0>(e1)) < std::get<0>(e2);
-}
+struct YogaSetter {
+  StyleProperty property;
+  SetterType type;
+  IntConverter int_converter;
+  IntSetter int_setter;
+  FloatSetter float_setter;
+  AutoSetter auto_setter;
+  FloatSetter percent_setter;
+  YGEdge edge;
+  EdgeSetter edge_setter;
+  EdgeSetter edge_percent_setter;
+};
 
-// Check if the array is sorted.
-template<typename T, size_t n>
-bool IsSorted(T (&setters)[n]) {
-  return std::is_sorted(std::begin(setters), std::end(setters),
-                        ElementCompare<T>);
+YogaSetter None(StyleProperty property) {
+  return {property, SetterType::None};
 }
 
-// Compare function to compare between elements and keys.
 template<typename T>
-bool FirstCompare(const T& element, const std::string& key) {
-  return std::get<0>(element) < key;
-}
-
-// Find out the setter from array.
-template<typename T, size_t n>
-T* Find(T (&setters)[n], const std::string& name) {
-  auto iter = std::lower_bound(std::begin(setters), std::end(setters), name,
-                               FirstCompare<T>);
-  if (iter == std::end(setters) || name != std::get<0>(*iter))
-    return nullptr;
-  return &(*iter);
+YogaSetter Int(StyleProperty property,
+               IntConverter converter,
+               void(*setter)(const YGNodeRef, T)) {
+  return {property, SetterType::Int, converter,
+          reinterpret_cast<IntSetter>(setter)};
 }
 
-// Set style for int properties.
-bool SetIntStyle(YGNodeRef node,
-                 const std::string& name,
-                 const std::string& value) {
-  auto* tup = Find(int_setters, name);
-  if (!tup)
-    return false;
-  int converted;
-  if (!std::get<1>(*tup)(value, &converted)) {
-    LOG(WARNING) << "Invalid value " << value << " for property " << name;
-    return false;
-  }
-  std::get<2>(*tup)(node, converted);
-  return true;
+YogaSetter Unit(StyleProperty property,
+                FloatSetter setter,
+                AutoSetter auto_setter = nullptr,
+                FloatSetter percent_setter = nullptr) {
+  return {property, SetterType::Unit, nullptr, nullptr, setter, auto_setter,
+          percent_setter};
 }
 
-// Set style for float properties.
-bool SetFloatStyle(YGNodeRef node, const std::string& name, float value) {
-  auto* tup = Find(float_setters, name);
-  if (!tup)
-    return false;
-  std::get<1>(*tup)(node, value);
-  return true;
+YogaSetter Edge(StyleProperty property,
+                YGEdge edge,
+                EdgeSetter setter,
+                EdgeSetter percent_setter = nullptr) {
+  return {property, SetterType::Edge, nullptr, nullptr, nullptr, nullptr,
+          nullptr, edge, setter, percent_setter};
 }
 
-// Set "auto" property for styles.
-bool SetAutoStyle(YGNodeRef node, const std::string& name) {
-  auto* tup = Find(auto_setters, name);
-  if (!tup)
-    return false;
-  std::get<1>(*tup)(node);
-  return true;
-}
-
-// Dispatch to float for auto depending on the value.
-bool SetUnitStyle(YGNodeRef node,
-                  const std::string& name,
-                  const std::string& value) {
-  if (value == "auto")
-    return SetAutoStyle(node, name);
-  else
-    return SetFloatStyle(node, name, PixelValue(value));
-}
+// Setters indexed by StyleProperty.
+using P = StyleProperty;
+const YogaSetter setters[] = {
+  Int(P::AlignContent, AlignValue, YGNodeStyleSetAlignContent),
+  Int(P::AlignItems, AlignValue, YGNodeStyleSetAlignItems),
+  Int(P::AlignSelf, AlignValue, YGNodeStyleSetAlignSelf),
+  Unit(P::AspectRatio, YGNodeStyleSetAspectRatio),
+  None(P::BackgroundColor),
+  Edge(P::Border, YGEdgeAll, YGNodeStyleSetBorder),
+  Edge(P::BorderBottom, YGEdgeBottom, YGNodeStyleSetBorder),
+  Edge(P::BorderLeft, YGEdgeLeft, YGNodeStyleSetBorder),
+  Edge(P::BorderRight, YGEdgeRight, YGNodeStyleSetBorder),
+  Edge(P::BorderTop, YGEdgeTop, YGNodeStyleSetBorder),
+  Edge(P::Bottom, YGEdgeBottom, YGNodeStyleSetPosition,
+       YGNodeStyleSetPositionPercent),
+  None(P::Color),
+  Unit(P::ColumnGap, YGNodeStyleSetGapColumn),
+  Int(P::Direction, DirectionValue, YGNodeStyleSetDirection),
+  Int(P::Display, DisplayValue, YGNodeStyleSetDisplay),
+  Unit(P::Flex, YGNodeStyleSetFlex),
+  Unit(P::FlexBasis, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisAuto,
+       YGNodeStyleSetFlexBasisPercent),
+  Int(P::FlexDirection, FlexDirectionValue, YGNodeStyleSetFlexDirection),
+  Unit(P::FlexGrow, YGNodeStyleSetFlexGrow),
+  Unit(P::FlexShrink, YGNodeStyleSetFlexShrink),
+  Int(P::FlexWrap, WrapValue, YGNodeStyleSetFlexWrap),
+  Unit(P::Gap, YGNodeStyleSetGapAll),
+  Unit(P::Height, YGNodeStyleSetHeight, YGNodeStyleSetHeightAuto,
+       YGNodeStyleSetHeightPercent),
+  Int(P::JustifyContent, JustifyValue, YGNodeStyleSetJustifyContent),
+  Edge(P::Left, YGEdgeLeft, YGNodeStyleSetPosition,
+       YGNodeStyleSetPositionPercent),
+  Edge(P::Margin, YGEdgeAll, YGNodeStyleSetMargin,
+       YGNodeStyleSetMarginPercent),
+  Edge(P::MarginBottom, YGEdgeBottom, YGNodeStyleSetMargin,
+       YGNodeStyleSetMarginPercent),
+  Edge(P::MarginLeft, YGEdgeLeft, YGNodeStyleSetMargin,
+       YGNodeStyleSetMarginPercent),
+  Edge(P::MarginRight, YGEdgeRight, YGNodeStyleSetMargin,
+       YGNodeStyleSetMarginPercent),
+  Edge(P::MarginTop, YGEdgeTop, YGNodeStyleSetMargin,
+       YGNodeStyleSetMarginPercent),
+  Unit(P::MaxHeight, YGNodeStyleSetMaxHeight, nullptr,
+       YGNodeStyleSetMaxHeightPercent),
+  Unit(P::MaxWidth, YGNodeStyleSetMaxWidth, nullptr,
+       YGNodeStyleSetMaxWidthPercent),
+  Unit(P::MinHeight, YGNodeStyleSetMinHeight, nullptr,
+       YGNodeStyleSetMinHeightPercent),
+  Unit(P::MinWidth, YGNodeStyleSetMinWidth, nullptr,
+       YGNodeStyleSetMinWidthPercent),
+  Int(P::Overflow, OverflowValue, YGNodeStyleSetOverflow),
+  Edge(P::Padding, YGEdgeAll, YGNodeStyleSetPadding,
+       YGNodeStyleSetPaddingPercent),
+  Edge(P::PaddingBottom, YGEdgeBottom, YGNodeStyleSetPadding,
+       YGNodeStyleSetPaddingPercent),
+  Edge(P::PaddingLeft, YGEdgeLeft, YGNodeStyleSetPadding,
+       YGNodeStyleSetPaddingPercent),
+  Edge(P::PaddingRight, YGEdgeRight, YGNodeStyleSetPadding,
+       YGNodeStyleSetPaddingPercent),
+  Edge(P::PaddingTop, YGEdgeTop, YGNodeStyleSetPadding,
+       YGNodeStyleSetPaddingPercent),
+  Int(P::Position, PositionValue, YGNodeStyleSetPositionType),
+  Edge(P::Right, YGEdgeRight, YGNodeStyleSetPosition,
+       YGNodeStyleSetPositionPercent),
+  Unit(P::RowGap, YGNodeStyleSetGapRow),
+  Edge(P::Top, YGEdgeTop, YGNodeStyleSetPosition,
+       YGNodeStyleSetPositionPercent),
+  Unit(P::Width, YGNodeStyleSetWidth, YGNodeStyleSetWidthAuto,
+       YGNodeStyleSetWidthPercent),
+};
 
-// Set style for percent properties.
-bool SetPercentStyle(YGNodeRef node,
-                     const std::string& name,
-                     const std::string& value) {
-  auto* tup = Find(percent_setters, name);
-  if (!tup)
-    return false;
-  std::get<1>(*tup)(node, PercentValue(value));
-  return true;
-}
+static_assert(std::size(setters) == kStylePropertyCount,
+              "Every style property must have a setter");
 
-// Set style for edge properties.
-bool SetEdgeStyle(YGNodeRef node, const std::string& name, float value) {
-  auto* tup = Find(edge_setters, name);
-  if (!tup)
-    return false;
-  std::get<2>(*tup)(node, std::get<1>(*tup), value);
+// Check if the setters are indexed by their properties.
+bool IsIndexed() {
+  for (size_t i = 0; i < std::size(setters); ++i) {
+    if (static_cast<size_t>(setters[i].property) != i)
+      return false;
+  }
   return true;
 }
 
-bool SetEdgeStyle(YGNodeRef node,
-                  const std::string& name,
-                  const std::string& value) {
-  return SetEdgeStyle(node, name, PixelValue(value));
-}
-
-// Set style for edge percent properties.
-bool SetEdgePercentStyle(YGNodeRef node,
-                         const std::string& name,
-                         const std::string& value) {
-  auto* tup = Find(edge_percent_setters, name);
-  if (!tup)
-    return false;
-  std::get<2>(*tup)(node, std::get<1>(*tup), PercentValue(value));
-  return true;
+const YogaSetter* Find(StyleProperty property) {
+  DCHECK(IsIndexed()) << "Property setters must be indexed by property";
+  if (property == StyleProperty::Invalid)
+    return nullptr;
+  return &setters[static_cast<size_t>(property)];
 }
 
 // Check whether the value is xx%.
@@ -377,28 +314,81 @@ bool IsPercentValue(const std::string& value) {
 
 }  // namespace
 
-void SetYogaProperty(YGNodeRef node, const std::string& name, float value) {
-  SetFloatStyle(node, name, value) ||
-  SetEdgeStyle(node, name, value);
+YogaValue ParseYogaValue(StyleProperty property, const std::string& value) {
+  YogaValue parsed;
+  const YogaSetter* setter = Find(property);
+  if (!setter)
+    return parsed;
+  switch (setter->type) {
+    case SetterType::None:
+      break;
+    case SetterType::Int:
+      if (setter->int_converter(value, &parsed.enum_value)) {
+        parsed.type = YogaValue::Type::Enum;
+      } else {
+        LOG(WARNING) << "Invalid value " << value << " for property "
+                     << GetStylePropertyName(property);
+      }
+      break;
+    case SetterType::Unit:
+    case SetterType::Edge:
+      if (IsPercentValue(value)) {
+        parsed.type = YogaValue::Type::Percent;
+        parsed.number = PercentValue(value);
+      } else if (value == "auto" && setter->type == SetterType::Unit) {
+        parsed.type = YogaValue::Type::Auto;
+      } else {
+        parsed.type = YogaValue::Type::Point;
+        parsed.number = PixelValue(value);
+      }
+      break;
+  }
+  return parsed;
+}
+
+void SetYogaValue(YGNodeRef node,
+                  StyleProperty property,
+                  const YogaValue& value) {
+  const YogaSetter* setter = Find(property);
+  if (!setter)
+    return;
+  switch (value.type) {
+    case YogaValue::Type::Invalid:
+      break;
+    case YogaValue::Type::Enum:
+      if (setter->int_setter)
+        setter->int_setter(node, value.enum_value);
+      break;
+    case YogaValue::Type::Point:
+      if (setter->float_setter)
+        setter->float_setter(node, value.number);
+      else if (setter->edge_setter)
+        setter->edge_setter(node, setter->edge, value.number);
+      break;
+    case YogaValue::Type::Percent:
+      if (setter->percent_setter)
+        setter->percent_setter(node, value.number);
+      else if (setter->edge_percent_setter)
+        setter->edge_percent_setter(node, setter->edge, value.number);
+      break;
+    case YogaValue::Type::Auto:
+      if (setter->auto_setter)
+        setter->auto_setter(node);
+      break;
+  }
+}
+
+void SetYogaProperty(YGNodeRef node, StyleProperty property, float value) {
+  YogaValue point;
+  point.type = YogaValue::Type::Point;
+  point.number = value;
+  SetYogaValue(node, property, point);
 }
 
 void SetYogaProperty(YGNodeRef node,
-                     const std::string& name,
+                     StyleProperty property,
                      const std::string& value) {
-  DCHECK(IsSorted(int_setters) &&
-         IsSorted(float_setters) &&
-         IsSorted(auto_setters) &&
-         IsSorted(percent_setters) &&
-         IsSorted(edge_setters) &&
-         IsSorted(edge_percent_setters)) << "Property setters must be sorted";
-  if (IsPercentValue(value)) {
-    SetPercentStyle(node, name, value) ||
-    SetEdgePercentStyle(node, name, value);
-  } else {
-    SetIntStyle(node, name, value) ||
-    SetUnitStyle(node, name, value) ||
-    SetEdgeStyle(node, name, value);
-  }
+  SetYogaValue(node, property, ParseYogaValue(property, value));
 }
 
 }  // namespace nu
@@ -5,15 +5,44 @@
 #ifndef NATIVEUI_UTIL_YOGA_UTIL_H_
 #define NATIVEUI_UTIL_YOGA_UTIL_H_
 
+#include <stdint.h>
+
 #include <string>
 
 typedef struct YGNode *YGNodeRef;
 
 namespace nu {
 
-void SetYogaProperty(YGNodeRef node, const std::string& key, float value);
+enum class StyleProperty : uint8_t;
+
+// A layout value parsed from string.
+struct YogaValue {
+  enum class Type {
+    Invalid,
+    Point,
+    Percent,
+    Auto,
+    Enum,
+  };
+
+  Type type = Type::Invalid;
+  float number = 0;
+  int enum_value = 0;
+};
+
+// Parse the |value| for layout |property|, invalid values and non-layout
+// properties result in an Invalid value.
+YogaValue ParseYogaValue(StyleProperty property, const std::string& value);
+
+// Set the parsed |value| of layout |property|.
+void SetYogaValue(YGNodeRef node,
+                  StyleProperty property,
+                  const YogaValue& value);
+
+// Set the layout |property| of |node|, non-layout properties are ignored.
+void SetYogaProperty(YGNodeRef node, StyleProperty property, float value);
 void SetYogaProperty(YGNodeRef node,
-                     const std::string& key,
+                     StyleProperty property,
                      const std::string& value);
 
 }  // namespace nu
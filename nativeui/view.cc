@@ -6,11 +6,12 @@
 
 #include <utility>
 
-#include "base/strings/string_util.h"
 #include "nativeui/container.h"
 #include "nativeui/cursor.h"
 #include "nativeui/gfx/font.h"
 #include "nativeui/state.h"
+#include "nativeui/style_sheet.h"
+#include "nativeui/util/yoga_config.h"
 #include "nativeui/util/yoga_util.h"
 #include "nativeui/window.h"
 #include "third_party/yoga/yoga/YGNodePrint.h"
@@ -22,35 +23,18 @@
 
 namespace nu {
 
-namespace {
-
-// Convert case to lower and remove non-ASCII characters.
-std::string ParseName(const std::string& name) {
-  std::string parsed;
-  parsed.reserve(name.size());
-  for (char c : name) {
-    if (base::IsAsciiAlpha(c))
-      parsed.push_back(base::ToLowerASCII(c));
-  }
-  return parsed;
-}
-
-}  // namespace
-
 View::View() : view_(nullptr) {
   // Create node with the default yoga config.
-  yoga_config_ = YGConfigNew();
-  YGConfigCopy(yoga_config_, State::GetCurrent()->yoga_config());
-  node_ = YGNodeNewWithConfig(yoga_config_);
+  yoga_config_ = State::GetCurrent()->yoga_config();
+  node_ = YGNodeNewWithConfig(yoga_config_->get());
   YGNodeSetContext(node_, this);
 }
 
 View::~View() {
   PlatformDestroy();
 
-  // Free yoga config and node.
+  // Free yoga node, the config is released after it.
   YGNodeFree(node_);
-  YGConfigFree(yoga_config_);
 }
 
 void View::SetVisible(bool visible) {
@@ -140,17 +124,38 @@ void View::UpdateDefaultStyle() {
 }
 
 void View::SetStyleProperty(const std::string& name, const std::string& value) {
-  std::string key(ParseName(name));
-  if (key == "color")
+  SetStyleProperty(GetStyleProperty(name), value);
+}
+
+void View::SetStyleProperty(const std::string& name, float value) {
+  SetStyleProperty(GetStyleProperty(name), value);
+}
+
+void View::SetStyleProperty(StyleProperty property, const std::string& value) {
+  if (property == StyleProperty::Color)
     SetColor(Color(value));
-  else if (key == "backgroundcolor")
+  else if (property == StyleProperty::BackgroundColor)
     SetBackgroundColor(Color(value));
   else
-    SetYogaProperty(node_, key, value);
+    SetYogaProperty(node_, property, value);
 }
 
-void View::SetStyleProperty(const std::string& name, float value) {
-  SetYogaProperty(node_, ParseName(name), value);
+void View::SetStyleProperty(StyleProperty property, float value) {
+  SetYogaProperty(node_, property, value);
+}
+
+void View::SetStyles(StyleSheet* styles) {
+  if (!styles)
+    return;
+  for (const auto& entry : styles->entries_) {
+    if (entry.property == StyleProperty::Color)
+      SetColor(entry.color);
+    else if (entry.property == StyleProperty::BackgroundColor)
+      SetBackgroundColor(entry.color);
+    else
+      SetYogaValue(node_, entry.property, entry.layout);
+  }
+  Layout();
 }
 
 std::string View::GetComputedLayout() const {
@@ -168,17 +173,23 @@ SizeF View::GetMinimumSize() const {
 
 void View::SetParent(View* parent) {
   if (parent)
-    YGConfigCopy(yoga_config_, parent->yoga_config_);
+    SetYogaConfig(parent->yoga_config_);
   parent_ = parent;
 }
 
 void View::BecomeContentView(Window* window) {
-  if (window) {
-    YGConfigCopy(yoga_config_, window->GetYogaConfig());
-  }
+  if (window)
+    SetYogaConfig(window->GetYogaConfig());
   parent_ = nullptr;
 }
 
+void View::SetYogaConfig(scoped_refptr<YogaConfig> config) {
+  if (config == yoga_config_)
+    return;
+  YGNodeSetConfig(node_, config->get());
+  yoga_config_ = std::move(config);
+}
+
 bool View::IsContainer() const {
   return false;
 }
@@ -187,4 +198,7 @@ void View::OnSizeChanged() {
   on_size_changed.Emit(this);
 }
 
+void View::OnSchedulePaint() {
+}
+
 }  // namespace nu
@@ -16,9 +16,9 @@
 #include "nativeui/gfx/geometry/rect_f.h"
 #include "nativeui/gfx/geometry/size_f.h"
 #include "nativeui/responder.h"
+#include "nativeui/style_property.h"
 
 typedef struct YGNode *YGNodeRef;
-typedef struct YGConfig *YGConfigRef;
 
 #if defined(OS_LINUX)
 typedef struct _GtkTooltip GtkTooltip;
@@ -28,6 +28,8 @@ namespace nu {
 
 class Cursor;
 class Font;
+class StyleSheet;
+class YogaConfig;
 class Popover;
 class Window;
 
@@ -108,23 +110,18 @@ class NATIVEUI_EXPORT View : public Responder {
   // While this is public API, it should only be used by language bindings.
   void SetStyleProperty(const std::string& name, const std::string& value);
   void SetStyleProperty(const std::string& name, float value);
+  void SetStyleProperty(StyleProperty property, const std::string& value);
+  void SetStyleProperty(StyleProperty property, float value);
 
   // Set styles and re-compute the layout.
   template<typename... Args>
-  void SetStyle(const std::string& name, const std::string& value,
-                Args... args) {
-    SetStyleProperty(name, value);
-    SetStyle(args...);
+  void SetStyle(Args... args) {
+    SetStyleProperties(args...);
     Layout();
   }
-  template<typename... Args>
-  void SetStyle(const std::string& name, float value, Args... args) {
-    SetStyleProperty(name, value);
-    SetStyle(args...);
-    Layout();
-  }
-  void SetStyle() {
-  }
+
+  // Apply all styles of |styles| and re-compute the layout once.
+  void SetStyles(StyleSheet* styles);
 
   // Return the string representation of yoga style.
   std::string GetComputedLayout() const;
@@ -132,11 +129,28 @@ class NATIVEUI_EXPORT View : public Responder {
   // Return the minimum size of view.
   virtual SizeF GetMinimumSize() const;
 
+#if defined(OS_LINUX) || defined(OS_MAC)
+  // Set the opacity of the view and its children, from 0 to 1.
+  void SetOpacity(float opacity);
+  float GetOpacity() const;
+#endif
+
 #if defined(OS_MAC)
   void SetWantsLayer(bool wants);
   bool WantsLayer() const;
 #endif
 
+#if defined(OS_LINUX)
+  // Draw the view and its children from a cached bitmap, which is rendered
+  // again after SchedulePaint or layout changes of them. Subtrees that have
+  // native widgets are always drawn directly.
+  void SetCacheAsBitmap(bool cache);
+  bool IsCacheAsBitmap() const;
+
+  // Internal: Whether the cached bitmap has been rendered.
+  bool HasCachedBitmap() const;
+#endif
+
   // Get parent.
   View* GetParent() const { return parent_; }
 
@@ -156,6 +170,9 @@ class NATIVEUI_EXPORT View : public Responder {
   // Internal: Notify that view's size has changed.
   virtual void OnSizeChanged();
 
+  // Internal: Notify that the view is going to be repainted.
+  virtual void OnSchedulePaint();
+
 #if defined(OS_LINUX)
   bool QueryTooltip(int x, int y, GtkTooltip* tooltip);
 #endif
@@ -215,8 +232,24 @@ class NATIVEUI_EXPORT View : public Responder {
   // The native implementation.
   NativeView view_;
 
-  // The config of its yoga node.
-  YGConfigRef yoga_config_;
+  // Unpack the arguments of SetStyle.
+  template<typename Key, typename... Args>
+  void SetStyleProperties(Key key, const std::string& value, Args... args) {
+    SetStyleProperty(key, value);
+    SetStyleProperties(args...);
+  }
+  template<typename Key, typename... Args>
+  void SetStyleProperties(Key key, float value, Args... args) {
+    SetStyleProperty(key, value);
+    SetStyleProperties(args...);
+  }
+  void SetStyleProperties() {}
+
+  // Change the config of yoga node.
+  void SetYogaConfig(scoped_refptr<YogaConfig> config);
+
+  // The config of its yoga node, shared with other views.
+  scoped_refptr<YogaConfig> yoga_config_;
 
   // The font used for the view.
   scoped_refptr<Font> font_;
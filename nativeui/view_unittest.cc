@@ -4,6 +4,24 @@
 
 #include "nativeui/nativeui.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/yoga/yoga/Yoga.h"
+
+class ColorContainer : public nu::Container {
+ public:
+  ColorContainer() {}
+
+  void SetColor(nu::Color color) override {
+    nu::Container::SetColor(color);
+    color_ = color;
+  }
+
+  nu::Color color() const { return color_; }
+
+ private:
+  ~ColorContainer() override {}
+
+  nu::Color color_;
+};
 
 class ViewTest : public testing::Test {
  protected:
@@ -90,3 +108,67 @@ TEST_F(ViewTest, OnSizeChanged) {
   window->SetContentSize(nu::SizeF(100, 100));
   EXPECT_TRUE(changed);
 }
+
+TEST_F(ViewTest, SharedYogaConfig) {
+  scoped_refptr<nu::Window> window(new nu::Window(nu::Window::Options()));
+  scoped_refptr<nu::Container> container(new nu::Container);
+  window->SetContentView(container.get());
+  int configs_before = YGConfigGetInstanceCount();
+  for (int i = 0; i < 100; ++i)
+    container->AddChildView(new nu::Container);
+  // Views used to own one YGConfig each.
+  EXPECT_LE(YGConfigGetInstanceCount() - configs_before, 1);
+  EXPECT_EQ(container->ChildAt(0)->GetWindow(), window.get());
+}
+
+TEST_F(ViewTest, StylePropertyNames) {
+  EXPECT_EQ(nu::GetStyleProperty("flex-direction"),
+            nu::StyleProperty::FlexDirection);
+  EXPECT_EQ(nu::GetStyleProperty("flexDirection"),
+            nu::StyleProperty::FlexDirection);
+  EXPECT_EQ(nu::GetStyleProperty("BackgroundColor"),
+            nu::StyleProperty::BackgroundColor);
+  EXPECT_EQ(nu::GetStyleProperty("flexdir"), nu::StyleProperty::Invalid);
+  EXPECT_EQ(nu::GetStyleProperty("widths"), nu::StyleProperty::Invalid);
+  EXPECT_EQ(nu::GetStyleProperty(""), nu::StyleProperty::Invalid);
+  for (size_t i = 0; i < nu::kStylePropertyCount; ++i) {
+    auto property = static_cast<nu::StyleProperty>(i);
+    EXPECT_EQ(nu::GetStyleProperty(nu::GetStylePropertyName(property)),
+              property);
+  }
+}
+
+TEST_F(ViewTest, SetStyleWithPropertyId) {
+  scoped_refptr<nu::View> view = new nu::Label("some text");
+  view->SetStyle("flex-direction", "row", "margin-left", 10, "width", "50%");
+  view_->SetStyle(nu::StyleProperty::FlexDirection, "row",
+                  nu::StyleProperty::MarginLeft, 10,
+                  nu::StyleProperty::Width, "50%");
+  EXPECT_EQ(view_->GetComputedLayout(), view->GetComputedLayout());
+}
+
+TEST_F(ViewTest, SetStyles) {
+  scoped_refptr<nu::StyleSheet> styles = new nu::StyleSheet;
+  styles->Set("flex-direction", "row");
+  styles->Set("margin-left", 10);
+  styles->Set("width", "50%");
+  styles->Set("width", "auto");
+  styles->Set("color", "#FF0000");
+  EXPECT_EQ(styles->GetSize(), 4u);
+  scoped_refptr<nu::View> view = new nu::Label("some text");
+  view->SetStyle("flex-direction", "row", "margin-left", 10, "width", "auto");
+  view_->SetStyles(styles.get());
+  EXPECT_EQ(view_->GetComputedLayout(), view->GetComputedLayout());
+}
+
+TEST_F(ViewTest, SetStylesNumericColor) {
+  scoped_refptr<nu::StyleSheet> styles = new nu::StyleSheet;
+  styles->Set(nu::StyleProperty::Color, "#FF0000");
+  // Numbers are ignored for colors, and do not replace the old value.
+  styles->Set(nu::StyleProperty::Color, 10.f);
+  styles->Set(nu::StyleProperty::BackgroundColor, 10.f);
+  EXPECT_EQ(styles->GetSize(), 1u);
+  scoped_refptr<ColorContainer> view = new ColorContainer;
+  view->SetStyles(styles.get());
+  EXPECT_EQ(view->color(), nu::Color(255, 0, 0));
+}
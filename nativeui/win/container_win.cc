@@ -247,8 +247,8 @@ class ContainerAdapter : public ContainerImpl,
     painter->Save();
     painter->ClipRectPixel(Rect(size_allocation().size()));
     float scale_factor = container_->GetNative()->scale_factor();
-    container_->on_draw.Emit(container_, static_cast<Painter*>(painter),
-                             ScaleRect(RectF(dirty), 1.0f / scale_factor));
+    container_->Draw(static_cast<Painter*>(painter),
+                     ScaleRect(RectF(dirty), 1.0f / scale_factor));
     painter->Restore();
   }
 
@@ -30,7 +30,7 @@ namespace nu {
 void State::PlatformInit() {
   base::win::EnableHighDPISupport();
 
-  YGConfigSetPointScaleFactor(yoga_config(), Screen::GetDefaultScaleFactor());
+  yoga_config_ = YogaConfig::Get(Screen::GetDefaultScaleFactor());
 
   // Initialize Common Controls.
   INITCOMMONCONTROLSEX config;
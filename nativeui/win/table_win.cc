@@ -430,6 +430,10 @@ void Table::NotifyRowInsertion(uint32_t row) {
                           LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
 }
 
+void Table::NotifyRowsInsertion(uint32_t row, uint32_t count) {
+  NotifyRowInsertion(row);
+}
+
 void Table::NotifyRowDeletion(uint32_t row) {
   auto* table = static_cast<TableImpl*>(GetNative());
   ListView_SetItemCountEx(table->hwnd(), GetModel()->GetRowCount(),
@@ -7,6 +7,7 @@
 #include <richedit.h>
 
 #include <algorithm>
+#include <limits>
 
 #include "base/strings/utf_string_conversions.h"
 #include "nativeui/gfx/attributed_text.h"
@@ -57,9 +58,41 @@ TextEdit::~TextEdit() {
 }
 
 void TextEdit::SetText(const std::string& text) {
+  CancelLoad();
   static_cast<EditView*>(GetNative())->SetText(text);
 }
 
+void TextEdit::PlatformBeginLoad() {
+  HWND hwnd = static_cast<SubwinView*>(GetNative())->hwnd();
+  read_only_before_load_ =
+      (::GetWindowLong(hwnd, GWL_STYLE) & ES_READONLY) != 0;
+  ::SendMessage(hwnd, EM_SETREADONLY, TRUE, 0L);
+  // Stop sending EN_CHANGE and recording undo while loading.
+  ::SendMessage(hwnd, EM_SETEVENTMASK, 0L, ENM_REQUESTRESIZE);
+  ::SendMessage(hwnd, EM_SETUNDOLIMIT, 0, 0L);
+  // The default limit only allows 64K characters.
+  ::SendMessage(hwnd, EM_EXLIMITTEXT, 0, std::numeric_limits<int>::max());
+  ::SetWindowTextW(hwnd, L"");
+}
+
+void TextEdit::PlatformAppendText(const char* text, size_t length) {
+  HWND hwnd = static_cast<SubwinView*>(GetNative())->hwnd();
+  // Programmatic replacing is not guaranteed to work on read-only RichEdit.
+  ::SendMessage(hwnd, EM_SETREADONLY, FALSE, 0L);
+  ::SendMessage(hwnd, EM_SETSEL, -1, -1);
+  ::SendMessageW(hwnd, EM_REPLACESEL, FALSE, reinterpret_cast<LPARAM>(
+      base::UTF8ToWide(base::StringPiece(text, length)).c_str()));
+  ::SendMessage(hwnd, EM_SETREADONLY, TRUE, 0L);
+}
+
+void TextEdit::PlatformEndLoad() {
+  HWND hwnd = static_cast<SubwinView*>(GetNative())->hwnd();
+  ::SendMessage(hwnd, EM_SETUNDOLIMIT, 100, 0L);
+  ::SendMessage(hwnd, EM_EMPTYUNDOBUFFER, 0, 0L);
+  ::SendMessage(hwnd, EM_SETEVENTMASK, 0L, ENM_CHANGE | ENM_REQUESTRESIZE);
+  ::SendMessage(hwnd, EM_SETREADONLY, read_only_before_load_, 0L);
+}
+
 std::string TextEdit::GetText() const {
   return static_cast<EditView*>(GetNative())->GetText();
 }
@@ -111,7 +144,26 @@ void TextEdit::SelectRange(int start, int end) {
 }
 
 std::string TextEdit::GetTextInRange(int start, int end) const {
-  return GetText().substr(start, end - start);
+  std::string result;
+  ReadRange(start, end, &result);
+  return result;
+}
+
+void TextEdit::ReadRange(int start, int end, std::string* out) const {
+  HWND hwnd = static_cast<SubwinView*>(GetNative())->hwnd();
+  std::wstring text16(std::max(end - start, 0) + 1, L'\0');
+  TEXTRANGEW range = {{start, end}, &text16[0]};
+  LRESULT length = ::SendMessageW(hwnd, EM_GETTEXTRANGE, 0,
+                                  reinterpret_cast<LPARAM>(&range));
+  base::WideToUTF8(text16.c_str(), length, out);
+}
+
+int TextEdit::GetTextLength() const {
+  HWND hwnd = static_cast<SubwinView*>(GetNative())->hwnd();
+  GETTEXTLENGTHEX options = {GTL_NUMCHARS | GTL_PRECISE, 1200};
+  return static_cast<int>(::SendMessageW(hwnd, EM_GETTEXTLENGTHEX,
+                                         reinterpret_cast<WPARAM>(&options),
+                                         0));
 }
 
 void TextEdit::InsertText(const std::string& text) {
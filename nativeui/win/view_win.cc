@@ -428,10 +428,12 @@ Rect View::GetPixelBounds() const {
 }
 
 void View::SchedulePaint() {
+  OnSchedulePaint();
   GetNative()->Invalidate();
 }
 
 void View::SchedulePaintRect(const RectF& rect) {
+  OnSchedulePaint();
   Rect relative = ToEnclosedRect(ScaleRect(rect, GetNative()->scale_factor()));
   GetNative()->Invalidate(relative +
                           GetNative()->size_allocation().OffsetFromOrigin());
@@ -852,8 +852,7 @@ void Window::PlatformInit(const Options& options) {
   window_ = new WindowImpl(options, this);
 
   InitResponder(window_, Type::Window);
-  YGConfigSetPointScaleFactor(yoga_config_,
-                              GetScaleFactorForHWND(window_->hwnd()));
+  yoga_config_ = YogaConfig::Get(GetScaleFactorForHWND(window_->hwnd()));
 }
 
 void Window::PlatformDestroy() {
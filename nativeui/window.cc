@@ -9,6 +9,7 @@
 
 #include "nativeui/container.h"
 #include "nativeui/menu_bar.h"
+#include "nativeui/state.h"
 #include "third_party/yoga/yoga/Yoga.h"
 
 #if defined(OS_MAC)
@@ -23,7 +24,7 @@ const char Window::kClassName[] = "Window";
 Window::Window(const Options& options)
     : has_frame_(options.frame),
       transparent_(options.transparent),
-      yoga_config_(YGConfigNew()) {
+      yoga_config_(State::GetCurrent()->yoga_config()) {
   // Initialize.
   PlatformInit(options);
   SetContentView(new Container);
@@ -37,7 +38,6 @@ Window::Window(const Options& options)
 
 Window::~Window() {
   PlatformDestroy();
-  YGConfigFree(yoga_config_);
   content_view_->BecomeContentView(nullptr);
 }
 
@@ -13,6 +13,7 @@
 #include "nativeui/container.h"
 #include "nativeui/gfx/color.h"
 #include "nativeui/gfx/geometry/rect_f.h"
+#include "nativeui/util/yoga_config.h"
 
 #if defined(OS_WIN)
 #include "base/win/scoped_gdi_object.h"
@@ -149,7 +150,7 @@ class NATIVEUI_EXPORT Window : public Responder {
   NativeWindow GetNative() const { return window_; }
 
   // Internal: Get the yogo config object.
-  YGConfigRef GetYogaConfig() const { return yoga_config_; }
+  YogaConfig* GetYogaConfig() const { return yoga_config_.get(); }
 
   // Responder:
   const char* GetClassName() const override;
@@ -185,7 +186,7 @@ class NATIVEUI_EXPORT Window : public Responder {
   bool transparent_;
 
   // The yoga config for window's children.
-  YGConfigRef yoga_config_;
+  scoped_refptr<YogaConfig> yoga_config_;
 
   // Whehter window has been closed.
   bool is_closed_ = false;
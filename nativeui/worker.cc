@@ -0,0 +1,103 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/worker.h"
+
+#include <utility>
+
+#include "base/system/sys_info.h"
+#include "base/threading/simple_thread.h"
+#include "nativeui/message_loop.h"
+
+namespace nu {
+
+class Worker::Thread : public base::SimpleThread {
+ public:
+  explicit Thread(Worker* worker)
+      : base::SimpleThread("YueWorker"), worker_(worker) {}
+
+  // base::SimpleThread:
+  void Run() override {
+    std::unique_ptr<Runner> runner = worker_->factory_();
+    worker_->RunTasks(runner.get());
+  }
+
+ private:
+  Worker* worker_;
+};
+
+Worker::Worker(RunnerFactory factory, int threads)
+    : factory_(std::move(factory)),
+      thread_count_(threads > 0 ? threads
+                                : base::SysInfo::NumberOfProcessors()),
+      has_task_(&lock_) {
+}
+
+Worker::~Worker() {
+  Terminate();
+}
+
+void Worker::PostTask(base::Value arg, Reply reply) {
+  {
+    base::AutoLock auto_lock(lock_);
+    if (terminated_)
+      return;
+    tasks_.push({std::move(arg), std::move(reply)});
+  }
+  // Threads are started lazily so runners are only created when needed.
+  if (threads_.empty()) {
+    for (int i = 0; i < thread_count_; ++i) {
+      threads_.emplace_back(new Thread(this));
+      threads_.back()->Start();
+    }
+  }
+  has_task_.Signal();
+}
+
+void Worker::Terminate() {
+  {
+    base::AutoLock auto_lock(lock_);
+    if (terminated_)
+      return;
+    terminated_ = true;
+  }
+  has_task_.Broadcast();
+  for (auto& thread : threads_)
+    thread->Join();
+  threads_.clear();
+  // Replies may hold references to the language bindings' VM, so they must be
+  // destroyed on the GUI thread.
+  std::queue<PendingTask>().swap(tasks_);
+}
+
+size_t Worker::GetPendingTaskCount() const {
+  base::AutoLock auto_lock(lock_);
+  return tasks_.size();
+}
+
+void Worker::RunTasks(Runner* runner) {
+  while (true) {
+    PendingTask task;
+    {
+      base::AutoLock auto_lock(lock_);
+      while (!terminated_ && tasks_.empty())
+        has_task_.Wait();
+      if (terminated_)
+        return;
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    auto result = std::make_shared<base::Value>();
+    bool success = runner->Run(std::move(task.arg), result.get());
+    // The std::function used by MessageLoop must be copyable, and the last
+    // reference to |reply| must be released on the GUI thread.
+    auto reply = std::make_shared<Reply>(std::move(task.reply));
+    MessageLoop::PostTask([reply = std::move(reply), success,
+                           result = std::move(result)]() {
+      (*reply)(success, std::move(*result));
+    });
+  }
+}
+
+}  // namespace nu
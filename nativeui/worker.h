@@ -0,0 +1,83 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_WORKER_H_
+#define NATIVEUI_WORKER_H_
+
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "base/synchronization/condition_variable.h"
+#include "base/synchronization/lock.h"
+#include "base/values.h"
+#include "nativeui/nativeui_export.h"
+
+namespace nu {
+
+// Run tasks on a pool of background threads, and deliver results back to the
+// GUI thread through MessageLoop.
+//
+// Arguments and results are passed as base::Value and are always moved, so
+// BINARY values cross threads without being copied.
+class NATIVEUI_EXPORT Worker : public base::RefCounted<Worker> {
+ public:
+  // Does the actual work, one instance is created on each worker thread and
+  // is destroyed on the same thread. Language bindings use it to keep one VM
+  // per thread.
+  class Runner {
+   public:
+    virtual ~Runner() = default;
+
+    // Run the task with |arg|. On failure return false and put the error
+    // message in |result|.
+    virtual bool Run(base::Value arg, base::Value* result) = 0;
+  };
+
+  using RunnerFactory = std::function<std::unique_ptr<Runner>()>;
+  using Reply = std::function<void(bool success, base::Value result)>;
+
+  // When |threads| is 0 the number of processors is used.
+  explicit Worker(RunnerFactory factory, int threads = 0);
+
+  // Queue a task, the |reply| is called on GUI thread with the result.
+  void PostTask(base::Value arg, Reply reply);
+
+  // Stop all threads, pending tasks are dropped without replies.
+  void Terminate();
+
+  int GetThreadCount() const { return thread_count_; }
+  size_t GetPendingTaskCount() const;
+
+ protected:
+  virtual ~Worker();
+
+ private:
+  friend class base::RefCounted<Worker>;
+
+  class Thread;
+
+  struct PendingTask {
+    base::Value arg;
+    Reply reply;
+  };
+
+  // Called on worker threads.
+  void RunTasks(Runner* runner);
+
+  RunnerFactory factory_;
+  int thread_count_;
+  std::vector<std::unique_ptr<Thread>> threads_;
+
+  mutable base::Lock lock_;
+  base::ConditionVariable has_task_;
+  std::queue<PendingTask> tasks_;
+  bool terminated_ = false;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_WORKER_H_
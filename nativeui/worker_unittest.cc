@@ -0,0 +1,79 @@
+// Copyright 2026 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <memory>
+#include <vector>
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+class DoubleRunner : public nu::Worker::Runner {
+ public:
+  bool Run(base::Value arg, base::Value* result) override {
+    if (!arg.is_int()) {
+      *result = base::Value("not a number");
+      return false;
+    }
+    *result = base::Value(arg.GetInt() * 2);
+    return true;
+  }
+};
+
+std::unique_ptr<nu::Worker::Runner> CreateRunner() {
+  return std::make_unique<DoubleRunner>();
+}
+
+}  // namespace
+
+class WorkerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    worker_ = new nu::Worker(&CreateRunner, 2);
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  scoped_refptr<nu::Worker> worker_;
+};
+
+TEST_F(WorkerTest, ReplyOnMainThread) {
+  worker_->PostTask(base::Value(21), [](bool success, base::Value result) {
+    EXPECT_TRUE(success);
+    EXPECT_EQ(result.GetInt(), 42);
+    nu::MessageLoop::Quit();
+  });
+  nu::MessageLoop::Run();
+}
+
+TEST_F(WorkerTest, Failure) {
+  worker_->PostTask(base::Value("str"), [](bool success, base::Value result) {
+    EXPECT_FALSE(success);
+    EXPECT_EQ(result.GetString(), "not a number");
+    nu::MessageLoop::Quit();
+  });
+  nu::MessageLoop::Run();
+}
+
+TEST_F(WorkerTest, ManyTasks) {
+  std::vector<int> results;
+  for (int i = 0; i < 100; ++i) {
+    worker_->PostTask(base::Value(i), [&results](bool, base::Value result) {
+      results.push_back(result.GetInt());
+      if (results.size() == 100)
+        nu::MessageLoop::Quit();
+    });
+  }
+  nu::MessageLoop::Run();
+  ASSERT_EQ(results.size(), 100u);
+}
+
+TEST_F(WorkerTest, Terminate) {
+  worker_->Terminate();
+  worker_->PostTask(base::Value(1), [](bool, base::Value) {
+    ADD_FAILURE() << "Should not run after termination";
+  });
+  EXPECT_EQ(worker_->GetPendingTaskCount(), 0u);
+}